@@ -0,0 +1,167 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+// Origen de la memoria del arena
+enum class ArenaBacking {
+    MALLOC, // std::malloc (comportamiento original)
+    MMAP    // mmap anónimo privado
+};
+
+// Páginas grandes para el arena (sólo con mmap)
+enum class HugePages {
+    NONE,        // Páginas normales del sistema
+    TRANSPARENT, // madvise(MADV_HUGEPAGE): el kernel decide si las usa
+    EXPLICIT     // MAP_HUGETLB: requiere páginas reservadas en vm.nr_hugepages
+};
+
+inline ArenaBacking parseArenaBacking(const std::string& name) {
+    if (name == "malloc") return ArenaBacking::MALLOC;
+    if (name == "mmap") return ArenaBacking::MMAP;
+    throw std::runtime_error("Tipo de arena desconocido: " + name);
+}
+
+inline HugePages parseHugePages(const std::string& name) {
+    if (name == "none") return HugePages::NONE;
+    if (name == "thp") return HugePages::TRANSPARENT;
+    if (name == "explicit") return HugePages::EXPLICIT;
+    throw std::runtime_error("Modo de paginas grandes desconocido: " + name);
+}
+
+struct ArenaOptions {
+    ArenaBacking backing = ArenaBacking::MALLOC;
+    HugePages hugePages = HugePages::NONE; // Distinto de NONE implica mmap
+    bool prefault = false;                 // Tocar todas las páginas al crear el arena
+};
+
+// Memoria contigua sobre la que trabajan los asignadores. Con mmap puede
+// usar páginas grandes para bajar los fallos de TLB en arenas grandes y
+// pre-cargarse (MAP_POPULATE) para no pagar fallos de página en el tráfico.
+class Arena {
+    char* base = nullptr;
+    size_t bytes;
+    size_t mappedBytes = 0; // Tamaño real del mapeo (redondeado a la página grande)
+    size_t pageBytes;
+    bool mapped = false;
+    bool transparentHuge = false;
+
+public:
+    Arena(size_t size, const ArenaOptions& options = {}) : bytes(size), pageBytes(systemPageSize()) {
+        if (options.backing == ArenaBacking::MALLOC && options.hugePages == HugePages::NONE) {
+            base = static_cast<char*>(std::malloc(bytes));
+            if (!base) throw std::bad_alloc();
+            if (options.prefault) {
+                for (size_t offset = 0; offset < bytes; offset += pageBytes) base[offset] = 0;
+            }
+            return;
+        }
+
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        if (options.prefault) flags |= MAP_POPULATE;
+
+        if (options.hugePages == HugePages::EXPLICIT) {
+            size_t hugeBytes = hugePageSize();
+            size_t rounded = (bytes + hugeBytes - 1) / hugeBytes * hugeBytes;
+            void* addr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+            if (addr != MAP_FAILED) {
+                base = static_cast<char*>(addr);
+                mappedBytes = rounded;
+                pageBytes = hugeBytes;
+                mapped = true;
+                return;
+            }
+            // Sin páginas reservadas se sigue con páginas normales
+            std::cerr << "MAP_HUGETLB no disponible, se usan paginas normales" << std::endl;
+        }
+
+        void* addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (addr == MAP_FAILED) throw std::bad_alloc();
+        base = static_cast<char*>(addr);
+        mappedBytes = bytes;
+        mapped = true;
+
+        if (options.hugePages == HugePages::TRANSPARENT) {
+            transparentHuge = madvise(base, mappedBytes, MADV_HUGEPAGE) == 0;
+            if (transparentHuge) pageBytes = hugePageSize();
+        }
+    }
+
+    ~Arena() {
+        if (mapped) munmap(base, mappedBytes);
+        else std::free(base);
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    char* data() const { return base; }
+    size_t size() const { return bytes; }
+
+    // Tamaño de página en uso; con THP es el que pidió madvise, el kernel
+    // puede igual dejar partes en páginas normales
+    size_t pageSize() const { return pageBytes; }
+
+    // Devuelve al sistema las páginas de [address, address + length), que
+    // deben estar alineadas a pageSize(). Con `lazy` usa MADV_FREE: el kernel
+    // sólo las reclama si le falta memoria. El contenido se pierde en ambos casos.
+    bool releasePages(char* address, size_t length, bool lazy) const {
+#ifdef MADV_FREE
+        if (lazy && madvise(address, length, MADV_FREE) == 0) return true;
+#endif
+        return madvise(address, length, MADV_DONTNEED) == 0;
+    }
+
+    // Bytes del arena que están en memoria física ahora mismo (según mincore)
+    size_t residentBytes() const {
+        size_t systemPage = systemPageSize();
+        uintptr_t begin = reinterpret_cast<uintptr_t>(base) / systemPage * systemPage;
+        uintptr_t end = reinterpret_cast<uintptr_t>(base) + bytes;
+        size_t pages = (end - begin + systemPage - 1) / systemPage;
+        std::vector<unsigned char> residency(pages);
+        if (mincore(reinterpret_cast<void*>(begin), end - begin, residency.data()) != 0) return 0;
+        size_t resident = 0;
+        for (unsigned char page : residency) {
+            if (page & 1) resident += systemPage;
+        }
+        return resident;
+    }
+
+    std::string describe() const {
+        std::string kind = !mapped ? "malloc"
+                         : pageBytes == systemPageSize() ? "mmap"
+                         : transparentHuge ? "mmap+thp" : "mmap+hugetlb";
+        return kind + " (page size " + std::to_string(pageBytes / 1024) + " KB)";
+    }
+
+    static size_t systemPageSize() {
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+
+    // Tamaño de página grande por defecto según /proc/meminfo (2 MB si no se puede leer)
+    static size_t hugePageSize() {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string key;
+        while (meminfo >> key) {
+            if (key == "Hugepagesize:") {
+                size_t kb;
+                if (meminfo >> kb) return kb * 1024;
+                break;
+            }
+            meminfo.ignore(256, '\n');
+        }
+        return 2 * 1024 * 1024;
+    }
+};
+
+#endif // ARENA_H
@@ -0,0 +1,167 @@
+#ifndef BLOCKID_H
+#define BLOCKID_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Un ID de bloque es un slot más una generación:
+//   bits 0..25  slot (índice denso, se recicla al liberar)
+//   bits 26..30 generación (sube cada vez que el slot se libera)
+// El bit de signo queda en 0 para que -1 siga significando "sin bloque". Un
+// MPointer viejo con un slot reciclado tiene otra generación y se rechaza en
+// vez de apuntar al bloque nuevo. Un slot que agotó sus 32 generaciones se
+// retira en vez de dar la vuelta, así un ID nunca se repite.
+//
+// Límites: a lo sumo kMaxBlockSlots - 1 (unos 67 millones) bloques vivos a la
+// vez, y unos 2^31 IDs en toda la vida del manager, como el contador int
+// original. Al llegar a cualquiera de los dos, acquire devuelve -1 y el
+// Create falla igual que sin memoria.
+constexpr unsigned kBlockSlotBits = 26;
+constexpr unsigned kBlockGenerationBits = 5;
+constexpr uint32_t kMaxBlockSlots = 1u << kBlockSlotBits;
+constexpr uint32_t kBlockGenerationMask = (1u << kBlockGenerationBits) - 1;
+
+constexpr uint32_t blockSlot(int id) {
+    return static_cast<uint32_t>(id) & (kMaxBlockSlots - 1);
+}
+
+constexpr uint32_t blockGeneration(int id) {
+    return (static_cast<uint32_t>(id) >> kBlockSlotBits) & kBlockGenerationMask;
+}
+
+constexpr int makeBlockId(uint32_t slot, uint32_t generation) {
+    return static_cast<int>(((generation & kBlockGenerationMask) << kBlockSlotBits) | slot);
+}
+
+// Arreglo indexado por slot, repartido en pedazos que se crean a demanda y
+// nunca se mueven: se puede leer sin locks mientras otro hilo agrega pedazos.
+template <typename Entry, uint32_t ChunkSlots = 4096>
+class SlotChunks {
+    std::array<std::atomic<Entry*>, kMaxBlockSlots / ChunkSlots> chunks{};
+
+public:
+    SlotChunks() = default;
+    SlotChunks(const SlotChunks&) = delete;
+    SlotChunks& operator=(const SlotChunks&) = delete;
+
+    ~SlotChunks() {
+        for (auto& chunk : chunks) delete[] chunk.load();
+    }
+
+    // Entrada del slot, o nullptr si su pedazo todavía no existe
+    Entry* find(uint32_t slot) const {
+        Entry* chunk = chunks[slot / ChunkSlots].load(std::memory_order_acquire);
+        return chunk ? &chunk[slot % ChunkSlots] : nullptr;
+    }
+
+    Entry& ensure(uint32_t slot) {
+        std::atomic<Entry*>& chunk = chunks[slot / ChunkSlots];
+        Entry* existing = chunk.load(std::memory_order_acquire);
+        if (!existing) {
+            Entry* fresh = new Entry[ChunkSlots];
+            if (chunk.compare_exchange_strong(existing, fresh, std::memory_order_acq_rel)) existing = fresh;
+            else delete[] fresh;
+        }
+        return existing[slot % ChunkSlots];
+    }
+};
+
+// Reparte IDs sin locks. Los slots libres forman una pila de Treiber cuya
+// cabeza lleva una etiqueta contra ABA; la generación y el enlace de cada
+// slot viven en SlotChunks. El slot 0 no se usa nunca. Un slot reciclado
+// enseguida (la pila es LIFO) quema sus generaciones rápido, pero al
+// agotarlas se retira: lo que se pierde son slots, nunca la detección.
+class BlockIdAllocator {
+    static constexpr uint32_t kNoSlot = 0;
+
+    struct SlotEntry {
+        std::atomic<uint32_t> generation{0};
+        std::atomic<uint32_t> next{kNoSlot}; // Siguiente slot libre en la pila
+    };
+
+    SlotChunks<SlotEntry> entries;
+    std::atomic<uint32_t> nextFreshSlot{1};
+    std::atomic<uint64_t> freeHead{0}; // Etiqueta (32 bits altos) | slot (32 bits bajos)
+    std::atomic<size_t> liveIds{0};
+    std::atomic<size_t> retiredSlots{0};
+
+    // Sólo para slots ya entregados, cuyo pedazo existe
+    SlotEntry& entry(uint32_t slot) const {
+        return *entries.find(slot);
+    }
+
+public:
+    BlockIdAllocator() = default;
+    BlockIdAllocator(const BlockIdAllocator&) = delete;
+    BlockIdAllocator& operator=(const BlockIdAllocator&) = delete;
+
+    // Un ID nuevo, o -1 si no quedan slots
+    int acquire() {
+        uint64_t head = freeHead.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head) != kNoSlot) {
+            uint32_t slot = static_cast<uint32_t>(head);
+            uint64_t next = ((head >> 32) + 1) << 32 | entry(slot).next.load(std::memory_order_relaxed);
+            if (freeHead.compare_exchange_weak(head, next, std::memory_order_acq_rel)) {
+                liveIds++;
+                return makeBlockId(slot, entry(slot).generation.load(std::memory_order_relaxed));
+            }
+        }
+
+        uint32_t slot = nextFreshSlot.load();
+        do {
+            if (slot >= kMaxBlockSlots) return -1;
+        } while (!nextFreshSlot.compare_exchange_weak(slot, slot + 1));
+        entries.ensure(slot);
+        liveIds++;
+        return makeBlockId(slot, 0);
+    }
+
+    // Devuelve el slot a la pila con la generación siguiente; el ID deja de
+    // ser válido. Si la generación daría la vuelta, el slot se retira.
+    void release(int id) {
+        liveIds--;
+        uint32_t generation = blockGeneration(id) + 1;
+        if (generation > kBlockGenerationMask) {
+            retiredSlots++;
+            return;
+        }
+        uint32_t slot = blockSlot(id);
+        entry(slot).generation.store(generation, std::memory_order_relaxed);
+        push(slot);
+    }
+
+    // Devuelve un ID que nunca llegó a usarse (el Create falló después de
+    // pedirlo); nadie lo vio, así que el slot vuelve con la misma generación
+    void cancel(int id) {
+        liveIds--;
+        push(blockSlot(id));
+    }
+
+    // Slots entregados alguna vez (cota del índice directo por slot)
+    uint32_t slotCount() const {
+        return nextFreshSlot.load() - 1;
+    }
+
+    size_t liveCount() const {
+        return liveIds.load();
+    }
+
+    // Slots que agotaron sus generaciones y no se vuelven a usar
+    size_t retiredCount() const {
+        return retiredSlots.load();
+    }
+
+private:
+    void push(uint32_t slot) {
+        SlotEntry& slotEntry = entry(slot);
+        uint64_t head = freeHead.load(std::memory_order_relaxed);
+        do {
+            slotEntry.next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        } while (!freeHead.compare_exchange_weak(head, ((head >> 32) + 1) << 32 | slot,
+                                                 std::memory_order_release, std::memory_order_relaxed));
+    }
+};
+
+#endif // BLOCKID_H
@@ -0,0 +1,138 @@
+#ifndef BLOCKTABLE_H
+#define BLOCKTABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "BlockId.h"
+#include "BlockType.h"
+
+// Contador de referencias que se puede guardar en un std::vector. La tabla
+// sólo copia o mueve entradas con el lock exclusivo de su shard, así que
+// basta copiar el valor actual.
+struct AtomicRefCount {
+    std::atomic<int32_t> value;
+
+    AtomicRefCount(int32_t initial = 1) : value(initial) {}
+    AtomicRefCount(const AtomicRefCount& other) : value(other.value.load()) {}
+    AtomicRefCount& operator=(const AtomicRefCount& other) {
+        value.store(other.value.load());
+        return *this;
+    }
+};
+
+// Metadatos de bloques guardados como structure of arrays: cada campo vive
+// en su propio arreglo denso, indexado por la posición del bloque. Los
+// recorridos de todo el heap (compactación, dump) leen sólo los arreglos que
+// necesitan, de forma secuencial. Borrar mueve el último bloque al hueco.
+// El índice ID -> posición es un arreglo directo por slot (ver BlockId.h);
+// con `stride` N la tabla sólo recibe uno de cada N slots.
+class BlockTable {
+public:
+    explicit BlockTable(size_t stride = 1) : stride(stride) {}
+
+    static constexpr uint8_t kInitialized = 1;
+    static constexpr uint8_t kInSlab = 2; // El bloque vive en un slab escalar y no en el asignador general
+    static constexpr uint8_t kInline = 4; // El valor se guarda en la entrada de addresses, sin arena
+    static constexpr size_t kInlineBytes = sizeof(void*);
+    static constexpr unsigned kAlignmentShift = 4; // Bits altos de flags: log2 de la alineación
+
+    std::vector<int32_t> ids;
+    std::vector<void*> addresses;
+    std::vector<uint32_t> sizes;
+    std::vector<BlockType> types;
+    std::vector<uint8_t> flags;
+    std::vector<AtomicRefCount> refcounts; // 0 = liberación en curso
+
+    size_t size() const { return ids.size(); }
+
+    size_t insert(int id, void* address, size_t size, BlockType type, bool inSlab, bool inlined = false,
+                  size_t alignment = 1) {
+        size_t pos = ids.size();
+        ids.push_back(id);
+        addresses.push_back(address);
+        sizes.push_back(static_cast<uint32_t>(size));
+        types.push_back(type);
+        unsigned alignmentLog2 = 0;
+        while ((size_t(1) << alignmentLog2) < alignment) alignmentLog2++;
+        flags.push_back(kInitialized | (inSlab ? kInSlab : 0) | (inlined ? kInline : 0) |
+                        (alignmentLog2 << kAlignmentShift));
+        refcounts.emplace_back(1);
+        size_t key = keyOf(id);
+        if (key >= index.size()) index.resize(key + 1, kNoPosition);
+        index[key] = static_cast<int32_t>(pos);
+        return pos;
+    }
+
+    // Posición del bloque; lanza si el ID no existe o es de una generación vieja
+    size_t find(int id) const {
+        int32_t pos = lookup(id);
+        if (pos == kNoPosition) throw std::runtime_error("ID no encontrado");
+        return static_cast<size_t>(pos);
+    }
+
+    bool contains(int id) const {
+        return lookup(id) != kNoPosition;
+    }
+
+    bool inSlab(size_t pos) const { return flags[pos] & kInSlab; }
+    bool initialized(size_t pos) const { return flags[pos] & kInitialized; }
+    bool isInline(size_t pos) const { return flags[pos] & kInline; }
+    bool inArena(size_t pos) const { return !(flags[pos] & (kInSlab | kInline)); }
+    size_t alignment(size_t pos) const { return size_t(1) << (flags[pos] >> kAlignmentShift); }
+
+    // Dónde están los bytes del valor: en el arena o, si es inline, en la
+    // propia entrada de addresses
+    void* valueAddress(size_t pos) const {
+        return isInline(pos) ? const_cast<void**>(&addresses[pos]) : addresses[pos];
+    }
+
+    void erase(size_t pos) {
+        index[keyOf(ids[pos])] = kNoPosition;
+
+        // Mover el último bloque al hueco para borrar en O(1)
+        size_t last = ids.size() - 1;
+        if (pos != last) {
+            ids[pos] = ids[last];
+            addresses[pos] = addresses[last];
+            sizes[pos] = sizes[last];
+            types[pos] = types[last];
+            flags[pos] = flags[last];
+            refcounts[pos] = refcounts[last];
+            index[keyOf(ids[pos])] = static_cast<int32_t>(pos);
+        }
+        ids.pop_back();
+        addresses.pop_back();
+        sizes.pop_back();
+        types.pop_back();
+        flags.pop_back();
+        refcounts.pop_back();
+    }
+
+    // Bytes de metadatos por bloque en los arreglos (sin contar el índice)
+    static constexpr size_t bytesPerBlock() {
+        return sizeof(int32_t) + sizeof(void*) + sizeof(uint32_t) + sizeof(BlockType) +
+               sizeof(uint8_t) + sizeof(AtomicRefCount);
+    }
+
+private:
+    static constexpr int32_t kNoPosition = -1;
+
+    size_t stride;
+    std::vector<int32_t> index; // slot / stride -> posición
+
+    size_t keyOf(int id) const {
+        return blockSlot(id) / stride;
+    }
+
+    int32_t lookup(int id) const {
+        if (id < 0) return kNoPosition;
+        size_t key = keyOf(id);
+        if (key >= index.size()) return kNoPosition;
+        int32_t pos = index[key];
+        return pos != kNoPosition && ids[pos] == id ? pos : kNoPosition;
+    }
+};
+
+#endif // BLOCKTABLE_H
@@ -0,0 +1,106 @@
+#ifndef BLOCKTYPE_H
+#define BLOCKTYPE_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Tipo de dato guardado en un bloque. Se traduce una sola vez desde el nombre
+// (allocate) o desde el DataType del proto; después todo compara enteros.
+enum class BlockType : uint8_t {
+    INT,
+    FLOAT,
+    DOUBLE,
+    CHAR,
+    BOOL,
+    SHORT,
+    LONG,
+    LONG_LONG,
+    UNSIGNED,
+    STRING
+};
+
+constexpr size_t kBlockTypeCount = static_cast<size_t>(BlockType::STRING) + 1;
+
+inline BlockType parseBlockType(const std::string& name) {
+    if (name == "int") return BlockType::INT;
+    if (name == "float") return BlockType::FLOAT;
+    if (name == "double") return BlockType::DOUBLE;
+    if (name == "char") return BlockType::CHAR;
+    if (name == "bool") return BlockType::BOOL;
+    if (name == "short") return BlockType::SHORT;
+    if (name == "long") return BlockType::LONG;
+    if (name == "long long") return BlockType::LONG_LONG;
+    if (name == "unsigned") return BlockType::UNSIGNED;
+    if (name == "string") return BlockType::STRING;
+    throw std::runtime_error("Tipo de dato desconocido: " + name);
+}
+
+inline const char* blockTypeName(BlockType type) {
+    switch (type) {
+        case BlockType::INT: return "int";
+        case BlockType::FLOAT: return "float";
+        case BlockType::DOUBLE: return "double";
+        case BlockType::CHAR: return "char";
+        case BlockType::BOOL: return "bool";
+        case BlockType::SHORT: return "short";
+        case BlockType::LONG: return "long";
+        case BlockType::LONG_LONG: return "long long";
+        case BlockType::UNSIGNED: return "unsigned";
+        case BlockType::STRING: return "string";
+    }
+    return "unknown";
+}
+
+// Tamaño mínimo de un bloque del tipo
+inline size_t blockTypeSize(BlockType type) {
+    switch (type) {
+        case BlockType::INT: return sizeof(int);
+        case BlockType::FLOAT: return sizeof(float);
+        case BlockType::DOUBLE: return sizeof(double);
+        case BlockType::CHAR: return sizeof(char);
+        case BlockType::BOOL: return sizeof(bool);
+        case BlockType::SHORT: return sizeof(short);
+        case BlockType::LONG: return sizeof(long);
+        case BlockType::LONG_LONG: return sizeof(long long);
+        case BlockType::UNSIGNED: return sizeof(unsigned);
+        case BlockType::STRING: return 1; // Minimum string size is 1 byte
+    }
+    return 1;
+}
+
+// Alineación natural del tipo; los strings no necesitan ninguna
+inline size_t blockTypeAlignment(BlockType type) {
+    switch (type) {
+        case BlockType::INT: return alignof(int);
+        case BlockType::FLOAT: return alignof(float);
+        case BlockType::DOUBLE: return alignof(double);
+        case BlockType::CHAR: return alignof(char);
+        case BlockType::BOOL: return alignof(bool);
+        case BlockType::SHORT: return alignof(short);
+        case BlockType::LONG: return alignof(long);
+        case BlockType::LONG_LONG: return alignof(long long);
+        case BlockType::UNSIGNED: return alignof(unsigned);
+        case BlockType::STRING: return 1;
+    }
+    return 1;
+}
+
+// true si T es el tipo C++ que corresponde a `type`
+template <typename T>
+constexpr bool isBlockType(BlockType type) {
+    if constexpr (std::is_same_v<T, int>) return type == BlockType::INT;
+    else if constexpr (std::is_same_v<T, float>) return type == BlockType::FLOAT;
+    else if constexpr (std::is_same_v<T, double>) return type == BlockType::DOUBLE;
+    else if constexpr (std::is_same_v<T, char>) return type == BlockType::CHAR;
+    else if constexpr (std::is_same_v<T, bool>) return type == BlockType::BOOL;
+    else if constexpr (std::is_same_v<T, short>) return type == BlockType::SHORT;
+    else if constexpr (std::is_same_v<T, long>) return type == BlockType::LONG;
+    else if constexpr (std::is_same_v<T, long long>) return type == BlockType::LONG_LONG;
+    else if constexpr (std::is_same_v<T, unsigned>) return type == BlockType::UNSIGNED;
+    else if constexpr (std::is_same_v<T, std::string>) return type == BlockType::STRING;
+    else return false;
+}
+
+#endif // BLOCKTYPE_H
@@ -0,0 +1,240 @@
+#ifndef BUDDYALLOCATOR_H
+#define BUDDYALLOCATOR_H
+
+#include "FreeSpaceAllocator.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+// Asignador buddy sobre el arena. Cada bloque mide una potencia de dos y está
+// alineado a su tamaño respecto al inicio del arena, así que su "buddy" se
+// obtiene con un XOR del offset. Un mapa de bits por orden marca qué bloques
+// están libres: dividir y fusionar sólo consulta y cambia bits, sin ordenar
+// ni recorrer listas. Los bloques siempre quedan fusionados al liberar, por
+// eso esta política no compacta.
+class BuddyAllocator : public FreeSpaceAllocator {
+public:
+    static constexpr unsigned kMinOrder = 3; // Bloque mínimo de 8 bytes
+    static constexpr unsigned kMaxOrders = 64;
+
+    void* allocate(size_t size) override {
+        unsigned order = orderFor(size);
+        if (order >= kMaxOrders) return nullptr;
+
+        unsigned k = order;
+        while (k < kMaxOrders && freeCount[k] == 0) k++;
+        if (k >= kMaxOrders) return nullptr;
+
+        size_t offset = popFree(k);
+        // Dividir hasta el orden pedido dejando libre la mitad derecha
+        while (k > order) {
+            k--;
+            pushFree(k, offset + (size_t(1) << k));
+        }
+        return base + offset;
+    }
+
+    void release(void* address, size_t size) override {
+        unsigned order = orderFor(size);
+        size_t offset = static_cast<char*>(address) - base;
+        forgetPadding(address);
+        if (!alignedBlocks.empty()) {
+            auto aligned = alignedBlocks.find(offset);
+            if (aligned != alignedBlocks.end()) {
+                offset = aligned->second.offset;
+                order = aligned->second.order;
+                alignedBlocks.erase(aligned);
+            }
+        }
+
+        while (order + 1 < kMaxOrders) {
+            size_t buddy = offset ^ (size_t(1) << order);
+            if (buddy + (size_t(1) << order) > length || !isFree(order, buddy)) break;
+            clearFree(order, buddy);
+            offset = std::min(offset, buddy);
+            order++;
+        }
+        pushFree(order, offset);
+    }
+
+    // Un bloque de al menos `alignment` bytes está alineado a `alignment`
+    // respecto al inicio del arena; si el base mismo no lo está, todos esos
+    // bloques quedan corridos lo mismo y se saltea ese prefijo. Como release
+    // deduce el orden del tamaño, los bloques agrandados o corridos recuerdan
+    // dónde empieza su bloque real.
+    void* allocateAligned(size_t size, size_t alignment) override {
+        if (alignment <= 1) return allocate(size);
+        size_t shift = (alignment - reinterpret_cast<uintptr_t>(base) % alignment) % alignment;
+        if (shift == 0 && alignment <= blockSpan(size)) return allocate(size);
+
+        unsigned order = orderFor(std::max(alignment, size + shift));
+        if (order >= kMaxOrders) return nullptr;
+        char* block = static_cast<char*>(allocate(size_t(1) << order));
+        if (!block) return nullptr;
+        alignedBlocks[block + shift - base] = {static_cast<size_t>(block - base), order};
+        recordPadding(block + shift, shift);
+        return block + shift;
+    }
+
+    size_t blockSpan(size_t size) const override {
+        return size_t(1) << orderFor(size);
+    }
+
+    bool supportsCompaction() const override { return false; }
+
+    // Los offsets son relativos a un único base: no se pueden sumar chunks sueltos
+    bool addRegion(const FreeBlock&) override {
+        return false;
+    }
+
+    void reset(const std::vector<FreeBlock>& regions) override {
+        for (unsigned k = 0; k < kMaxOrders; ++k) {
+            freeBits[k].clear();
+            freeLists[k].clear();
+            freeCount[k] = 0;
+        }
+        alignedBlocks.clear();
+        freeBytes = 0;
+        base = nullptr;
+        length = 0;
+        if (regions.empty()) return;
+
+        char* low = static_cast<char*>(regions.front().address);
+        char* high = low;
+        for (const auto& region : regions) {
+            low = std::min(low, static_cast<char*>(region.address));
+            high = std::max(high, static_cast<char*>(region.address) + region.size);
+        }
+        base = low;
+        length = high - low;
+        for (unsigned k = kMinOrder; k < kMaxOrders && (size_t(1) << k) <= length; ++k) {
+            freeBits[k].assign(((length >> k) + 63) / 64, 0);
+        }
+
+        // Descomponer cada región en bloques alineados de potencia de dos
+        for (const auto& region : regions) {
+            size_t offset = static_cast<char*>(region.address) - base;
+            size_t end = offset + region.size;
+            while (end - offset >= (size_t(1) << kMinOrder)) {
+                unsigned k = kMinOrder;
+                while (k + 1 < kMaxOrders &&
+                       (offset & ((size_t(1) << (k + 1)) - 1)) == 0 &&
+                       offset + (size_t(1) << (k + 1)) <= end) {
+                    k++;
+                }
+                pushFree(k, offset);
+                offset += size_t(1) << k;
+            }
+        }
+    }
+
+    std::vector<FreeBlock> freeBlocks() const override {
+        std::vector<FreeBlock> result;
+        for (unsigned k = kMinOrder; k < kMaxOrders; ++k) {
+            for (size_t w = 0; w < freeBits[k].size(); ++w) {
+                uint64_t word = freeBits[k][w];
+                while (word) {
+                    size_t index = w * 64 + __builtin_ctzll(word);
+                    result.push_back({base + (index << k), size_t(1) << k});
+                    word &= word - 1;
+                }
+            }
+        }
+        std::sort(result.begin(), result.end(), [](const FreeBlock& a, const FreeBlock& b) {
+            return a.address < b.address;
+        });
+        return result;
+    }
+
+    size_t totalFreeBytes() const override { return freeBytes; }
+
+    size_t largestFreeBlock() const override {
+        for (unsigned k = kMaxOrders; k-- > kMinOrder; ) {
+            if (freeCount[k] > 0) return size_t(1) << k;
+        }
+        return 0;
+    }
+
+    void writeStats(std::ostream& out) const override {
+        out << "Buddy Orders:\n";
+        for (unsigned k = kMinOrder; k < kMaxOrders; ++k) {
+            if (freeCount[k] == 0) continue;
+            out << "  Order: " << k << " (" << (size_t(1) << k) << " bytes)"
+                << " | Free blocks: " << freeCount[k] << "\n";
+        }
+    }
+
+    const char* name() const override { return "buddy"; }
+
+    static unsigned orderFor(size_t size) {
+        unsigned order = kMinOrder;
+        while (order < kMaxOrders && (size_t(1) << order) < size) order++;
+        return order;
+    }
+
+private:
+    // Bloque real detrás de una dirección entregada por allocateAligned
+    struct AlignedBlock {
+        size_t offset;
+        unsigned order;
+    };
+
+    char* base = nullptr;
+    size_t length = 0;
+    size_t freeBytes = 0;
+    std::array<std::vector<uint64_t>, kMaxOrders> freeBits; // Bit = bloque libre en ese orden
+    std::array<std::vector<size_t>, kMaxOrders> freeLists;  // Offsets candidatos (con entradas obsoletas)
+    std::array<size_t, kMaxOrders> freeCount{};             // Bloques realmente libres por orden
+    std::unordered_map<size_t, AlignedBlock> alignedBlocks; // Offset entregado -> bloque real
+
+    bool isFree(unsigned k, size_t offset) const {
+        size_t index = offset >> k;
+        return (freeBits[k][index / 64] >> (index % 64)) & 1;
+    }
+
+    void setFree(unsigned k, size_t offset) {
+        size_t index = offset >> k;
+        freeBits[k][index / 64] |= uint64_t(1) << (index % 64);
+        freeCount[k]++;
+        freeBytes += size_t(1) << k;
+    }
+
+    // Marca un bloque como ocupado; su entrada en freeLists queda obsoleta
+    void clearFree(unsigned k, size_t offset) {
+        size_t index = offset >> k;
+        freeBits[k][index / 64] &= ~(uint64_t(1) << (index % 64));
+        freeCount[k]--;
+        freeBytes -= size_t(1) << k;
+    }
+
+    void pushFree(unsigned k, size_t offset) {
+        setFree(k, offset);
+        freeLists[k].push_back(offset);
+        if (freeLists[k].size() > 2 * freeCount[k] + 64) pruneList(k);
+    }
+
+    // Elimina entradas obsoletas y duplicadas cuando la lista crece demasiado
+    void pruneList(unsigned k) {
+        std::vector<size_t>& list = freeLists[k];
+        list.erase(std::remove_if(list.begin(), list.end(),
+            [this, k](size_t offset) { return !isFree(k, offset); }), list.end());
+        std::sort(list.begin(), list.end(), std::greater<size_t>());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+    }
+
+    // Saca un bloque libre del orden k descartando entradas obsoletas
+    size_t popFree(unsigned k) {
+        std::vector<size_t>& list = freeLists[k];
+        while (true) {
+            size_t offset = list.back();
+            list.pop_back();
+            if (isFree(k, offset)) {
+                clearFree(k, offset);
+                return offset;
+            }
+        }
+    }
+};
+
+#endif // BUDDYALLOCATOR_H
@@ -0,0 +1,143 @@
+#ifndef COMPACTIONSCHEDULER_H
+#define COMPACTIONSCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Configuración del planificador de compactación en segundo plano
+struct CompactionSchedulerOptions {
+    double fragmentationThreshold = 0.5;  // 1 - mayor hueco / total libre
+    double failureRateThreshold = 0.01;   // Asignaciones fallidas / asignaciones en el intervalo
+    std::chrono::milliseconds interval{500};
+    size_t stepBytes = 64 * 1024;         // Bytes por paso; entre pasos se atienden peticiones
+};
+
+// Resultado de una compactación, para el log del servidor
+struct CompactionReport {
+    const char* reason;          // "idle" o "failures"
+    std::chrono::microseconds duration;
+    size_t bytesMoved;
+    double fragmentationBefore;
+    double fragmentationAfter;
+};
+
+// Hilo que compacta el MemoryManagerProgram fuera del camino de las peticiones
+// (incluir después de MemoryManagerProgram.cpp).
+// En cada intervalo mira la fragmentación y la tasa de fallos de asignación:
+// si el servidor está ocioso y la fragmentación supera el umbral, o si la tasa
+// de fallos supera el suyo, ejecuta una compactación incremental completa.
+class CompactionScheduler {
+public:
+    using ReportCallback = std::function<void(const CompactionReport&)>;
+
+    CompactionScheduler(MemoryManagerProgram& manager, const CompactionSchedulerOptions& options,
+                        ReportCallback onReport = nullptr)
+        : manager(manager), options(options), onReport(std::move(onReport)) {}
+
+    ~CompactionScheduler() {
+        stop();
+    }
+
+    void start() {
+        if (worker.joinable()) return;
+        stopping = false;
+        worker = std::thread([this] { run(); });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            stopping = true;
+        }
+        wakeup.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+    // Los handlers lo llaman en cada petición para detectar periodos ociosos
+    void recordRequest() {
+        requestCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Evalúa una vez las métricas y compacta si hace falta; devuelve true si compactó
+    bool tick() {
+        AllocationCounters current = manager.getAllocationCounters();
+        size_t requests = requestCount.load(std::memory_order_relaxed);
+
+        size_t allocations = current.allocations - lastCounters.allocations;
+        size_t failures = current.failures - lastCounters.failures;
+        bool mutated = allocations > 0 || current.frees != lastCounters.frees;
+        bool idle = requests == lastRequestCount;
+        double failureRate = allocations > 0 ? static_cast<double>(failures) / allocations : 0.0;
+
+        lastCounters = current;
+        lastRequestCount = requests;
+        if (mutated) dirty = true;
+
+        if (failures > 0 && failureRate >= options.failureRateThreshold) {
+            compact("failures");
+            return true;
+        }
+        // Si nada cambió desde la última compactación no hay nada nuevo que juntar
+        if (idle && dirty && manager.fragmentation() >= options.fragmentationThreshold) {
+            compact("idle");
+            return true;
+        }
+        // Sin carga, los chunks que crecieron y quedaron vacíos vuelven al sistema
+        if (idle) manager.releaseEmptyChunks();
+        return false;
+    }
+
+private:
+    MemoryManagerProgram& manager;
+    CompactionSchedulerOptions options;
+    ReportCallback onReport;
+
+    std::thread worker;
+    std::mutex waitMutex;
+    std::condition_variable wakeup;
+    bool stopping = false;
+
+    std::atomic<size_t> requestCount{0};
+    size_t lastRequestCount = 0;
+    AllocationCounters lastCounters;
+    bool dirty = false; // Hubo asignaciones o liberaciones desde la última compactación
+
+    void run() {
+        std::unique_lock<std::mutex> lock(waitMutex);
+        while (!stopping) {
+            if (wakeup.wait_for(lock, options.interval, [this] { return stopping; })) break;
+            lock.unlock();
+            tick();
+            lock.lock();
+        }
+    }
+
+    void compact(const char* reason) {
+        if (!manager.supportsCompaction()) return;
+
+        double before = manager.fragmentation();
+        size_t movedBefore = manager.getCompactionBytesMoved();
+        auto start = std::chrono::steady_clock::now();
+
+        // Cada paso toma y suelta el lock del manager, así las peticiones se intercalan
+        while (manager.compactStep(options.stepBytes)) {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            if (stopping) break;
+        }
+
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        dirty = false;
+
+        if (onReport) {
+            onReport({reason, duration, manager.getCompactionBytesMoved() - movedBefore,
+                      before, manager.fragmentation()});
+        }
+    }
+};
+
+#endif // COMPACTIONSCHEDULER_H
@@ -0,0 +1,261 @@
+#ifndef FREESPACEALLOCATOR_H
+#define FREESPACEALLOCATOR_H
+
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <ostream>
+#include <stdexcept>
+#include <cstdint>
+
+// Región libre dentro del arena
+struct FreeBlock {
+    void* address;
+    size_t size;
+};
+
+// Primera dirección >= `address` múltiplo de `alignment` (potencia de dos)
+inline char* alignUp(char* address, size_t alignment) {
+    uintptr_t value = reinterpret_cast<uintptr_t>(address);
+    return address + ((alignment - value % alignment) % alignment);
+}
+
+// Políticas de asignación disponibles para MemoryManagerProgram
+enum class AllocatorPolicy {
+    FIRST_FIT,   // Lista libre con primer ajuste (comportamiento original)
+    SIZE_CLASS,  // Listas segregadas por clases de tamaño potencia de dos
+    TLSF,        // Two-level segregated fit, O(1) acotado
+    BUDDY        // Sistema buddy con mapas de bits, sin compactación
+};
+
+inline AllocatorPolicy parseAllocatorPolicy(const std::string& name) {
+    if (name == "firstfit") return AllocatorPolicy::FIRST_FIT;
+    if (name == "sizeclass") return AllocatorPolicy::SIZE_CLASS;
+    if (name == "tlsf") return AllocatorPolicy::TLSF;
+    if (name == "buddy") return AllocatorPolicy::BUDDY;
+    throw std::runtime_error("Politica de asignacion desconocida: " + name);
+}
+
+// Interfaz común de los asignadores de espacio libre sobre el arena.
+// MemoryManagerProgram guarda los metadatos de cada bloque; el asignador
+// sólo conoce qué regiones del arena están libres.
+class FreeSpaceAllocator {
+public:
+    virtual ~FreeSpaceAllocator() = default;
+
+    // Devuelve una dirección con al menos `size` bytes, o nullptr si no hay espacio
+    virtual void* allocate(size_t size) = 0;
+
+    // Como allocate(size), pero la dirección queda alineada a `alignment`
+    // (potencia de dos); se libera igual, con release(address, size). Por
+    // defecto pide `alignment - 1` bytes de más y devuelve el sobrante de
+    // cada lado, así que sirve para cualquier política que acepte liberar
+    // tramos arbitrarios.
+    virtual void* allocateAligned(size_t size, size_t alignment) {
+        if (alignment <= 1) return allocate(size);
+        char* raw = static_cast<char*>(allocate(size + alignment - 1));
+        if (!raw) return nullptr;
+        char* aligned = alignUp(raw, alignment);
+        size_t prefix = aligned - raw;
+        size_t suffix = alignment - 1 - prefix;
+        if (prefix > 0) release(raw, prefix);
+        if (suffix > 0) release(aligned + size, suffix);
+        recordPadding(aligned, prefix);
+        return aligned;
+    }
+
+    // Bytes salteados para alinear los bloques vivos: quedan libres pero en
+    // huecos chicos delante de cada uno
+    virtual size_t paddingBytes() const { return padding; }
+
+    // Anota el hueco salteado delante del bloque que empieza en `address`
+    void recordPadding(const void* address, size_t bytes) {
+        if (bytes == 0) return;
+        paddedBlocks[address] += bytes;
+        padding += bytes;
+    }
+
+    // El bloque en `address` se liberó: su hueco ya no cuenta
+    void forgetPadding(const void* address) {
+        if (paddedBlocks.empty()) return;
+        auto it = paddedBlocks.find(address);
+        if (it == paddedBlocks.end()) return;
+        padding -= it->second;
+        paddedBlocks.erase(it);
+    }
+
+    // Se descarta todo lo anotado (la compactación vuelve a armar la disposición)
+    virtual void resetPadding() {
+        paddedBlocks.clear();
+        padding = 0;
+    }
+
+    // Devuelve al asignador un bloque obtenido con allocate(size)
+    virtual void release(void* address, size_t size) = 0;
+
+    // Bytes que realmente ocupa en el arena un bloque pedido con `size`
+    virtual size_t blockSpan(size_t size) const { return size; }
+
+    // false si los bloques no pueden moverse libremente (p.ej. deben quedar alineados)
+    virtual bool supportsCompaction() const { return true; }
+
+    // Reemplaza todo el espacio libre (se usa después de compactar)
+    virtual void reset(const std::vector<FreeBlock>& regions) = 0;
+
+    // Suma una región nueva y libre del arena (un chunk recién mapeado). Las
+    // regiones nunca son contiguas entre sí. false si la política no puede crecer.
+    virtual bool addRegion(const FreeBlock& region) {
+        release(region.address, region.size);
+        return true;
+    }
+
+    // Quita una región que está completamente libre (un chunk que se libera)
+    virtual void removeRegion(const FreeBlock& region) {
+        char* begin = static_cast<char*>(region.address);
+        char* end = begin + region.size;
+        std::vector<FreeBlock> remaining;
+        for (const auto& block : freeBlocks()) {
+            char* addr = static_cast<char*>(block.address);
+            if (addr < begin || addr >= end) remaining.push_back(block);
+        }
+        reset(remaining);
+    }
+
+    // Regiones libres actuales (para el dump)
+    virtual std::vector<FreeBlock> freeBlocks() const = 0;
+
+    // Total de bytes libres
+    virtual size_t totalFreeBytes() const {
+        size_t total = 0;
+        for (const auto& block : freeBlocks()) total += block.size;
+        return total;
+    }
+
+    // Tamaño del mayor bloque libre
+    virtual size_t largestFreeBlock() const {
+        size_t largest = 0;
+        for (const auto& block : freeBlocks()) largest = std::max(largest, block.size);
+        return largest;
+    }
+
+    // Fragmentación externa: 0 si todo lo libre es un solo bloque, cerca de 1
+    // si lo libre está repartido en muchos huecos pequeños
+    double fragmentation() const {
+        size_t total = totalFreeBytes();
+        if (total == 0) return 0.0;
+        return 1.0 - static_cast<double>(largestFreeBlock()) / static_cast<double>(total);
+    }
+
+    // Estadísticas propias de la política (para el dump)
+    virtual void writeStats(std::ostream&) const {}
+
+    virtual const char* name() const = 0;
+
+private:
+    size_t padding = 0;
+    std::unordered_map<const void*, size_t> paddedBlocks; // Bloque -> hueco salteado delante
+};
+
+// Lista libre con primer ajuste. Los bloques libres se guardan en un árbol
+// ordenado por dirección, así que al liberar sólo se revisan los vecinos
+// izquierdo y derecho para fusionar (O(log n)).
+class FirstFitAllocator : public FreeSpaceAllocator {
+    std::map<char*, size_t> freeList; // Dirección -> tamaño
+    size_t freeBytes = 0;
+
+public:
+    void* allocate(size_t size) override {
+        for (auto it = freeList.begin(); it != freeList.end(); ++it) {
+            if (it->second >= size) {
+                char* addr = it->first;
+                size_t remaining = it->second - size;
+                auto hint = freeList.erase(it);
+                freeBytes -= size;
+                if (remaining > 0) {
+                    freeList.emplace_hint(hint, addr + size, remaining);
+                }
+                return addr;
+            }
+        }
+        return nullptr;
+    }
+
+    // Primer hueco donde entra el bloque ya alineado; lo salteado queda libre
+    void* allocateAligned(size_t size, size_t alignment) override {
+        if (alignment <= 1) return allocate(size);
+        for (auto it = freeList.begin(); it != freeList.end(); ++it) {
+            char* hole = it->first;
+            char* aligned = alignUp(hole, alignment);
+            size_t prefix = aligned - hole;
+            if (it->second < prefix || it->second - prefix < size) continue;
+
+            size_t remaining = it->second - prefix - size;
+            freeList.erase(it);
+            freeBytes -= prefix + size + remaining;
+            if (remaining > 0) insertAndMerge(aligned + size, remaining);
+            if (prefix > 0) insertAndMerge(hole, prefix);
+            recordPadding(aligned, prefix);
+            return aligned;
+        }
+        return nullptr;
+    }
+
+    void release(void* address, size_t size) override {
+        forgetPadding(address);
+        insertAndMerge(static_cast<char*>(address), size);
+    }
+
+    void reset(const std::vector<FreeBlock>& regions) override {
+        freeList.clear();
+        freeBytes = 0;
+        for (const auto& region : regions) {
+            insertAndMerge(static_cast<char*>(region.address), region.size);
+        }
+    }
+
+    std::vector<FreeBlock> freeBlocks() const override {
+        std::vector<FreeBlock> result;
+        result.reserve(freeList.size());
+        for (const auto& [addr, size] : freeList) {
+            result.push_back({addr, size});
+        }
+        return result;
+    }
+
+    size_t totalFreeBytes() const override { return freeBytes; }
+
+    size_t largestFreeBlock() const override {
+        size_t largest = 0;
+        for (const auto& entry : freeList) largest = std::max(largest, entry.second);
+        return largest;
+    }
+
+    const char* name() const override { return "firstfit"; }
+
+private:
+    // Inserta un bloque libre fusionándolo con sus vecinos adyacentes
+    void insertAndMerge(char* addr, size_t size) {
+        if (size == 0) return;
+        freeBytes += size;
+
+        auto next = freeList.lower_bound(addr);
+        if (next != freeList.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == addr) {
+                addr = prev->first;
+                size += prev->second;
+                freeList.erase(prev);
+            }
+        }
+        if (next != freeList.end() && addr + size == next->first) {
+            size += next->second;
+            next = freeList.erase(next);
+        }
+        freeList.emplace_hint(next, addr, size);
+    }
+};
+
+#endif // FREESPACEALLOCATOR_H
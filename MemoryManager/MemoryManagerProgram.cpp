@@ -4,17 +4,38 @@
 #include <string>
 #include <type_traits>
 #include <cstring>
+#include <cstddef>
 #include <stdexcept>
 #include <memory>
+#include <unordered_map>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <shared_mutex>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include "Arena.h"
+#include "FreeSpaceAllocator.h"
+#include "SizeClassAllocator.h"
+#include "TlsfAllocator.h"
+#include "BuddyAllocator.h"
+#include "SlabAllocator.h"
+#include "BlockId.h"
+#include "BlockType.h"
+#include "BlockTable.h"
 
+// Vista sobre los bytes de un bloque en el arena; no guarda nada propio
 class MemoryBlock {
 public:
     void* address;
     size_t size;
-    std::string type;
+    BlockType type;
 
 
-    MemoryBlock(void* address, size_t size, std::string type = "int")
+    MemoryBlock(void* address, size_t size, BlockType type = BlockType::INT)
         : address(address), size(size), type(type) {}
 
     // Método genérico para tipos POD (versión const)
@@ -35,7 +56,7 @@ public:
     // Método para strings (versión const)
     std::string getStringValue() const {
         if (!address) throw std::runtime_error("Intento de leer memoria NULL");
-        if (type != "string") throw std::runtime_error("No es un bloque de string");
+        if (type != BlockType::STRING) throw std::runtime_error("No es un bloque de string");
 
         // Cambio clave: usar strnlen para encontrar el null terminator
         const char* str = static_cast<const char*>(address);
@@ -59,7 +80,7 @@ public:
     // Método para asignar strings
     void setStringValue(const std::string& value) {
         if (!address) throw std::runtime_error("Intento de escribir en memoria NULL");
-        if (type != "string") throw std::runtime_error("No es un bloque de string");
+        if (type != BlockType::STRING) throw std::runtime_error("No es un bloque de string");
         if (value.size() >= size) throw std::runtime_error("Tamaño del string excede el tamaño del bloque");
 
         // Cambio clave: copiar el string y agregar null terminator explícito
@@ -71,54 +92,247 @@ private:
     // Verifica la compatibilidad de tipos (versión const)
     template <typename T>
     bool isTypeValid() const {
-        if (type == "int" && std::is_same<T, int>::value) return true;
-        if (type == "float" && std::is_same<T, float>::value) return true;
-        if (type == "double" && std::is_same<T, double>::value) return true;
-        if (type == "char" && std::is_same<T, char>::value) return true;
-        if (type == "bool" && std::is_same<T, bool>::value) return true;
-        if (type == "short" && std::is_same<T, short>::value) return true;
-        if (type == "long" && std::is_same<T, long>::value) return true;
-        if (type == "long long" && std::is_same<T, long long>::value) return true;
-        if (type == "unsigned" && std::is_same<T, unsigned>::value) return true;
-        return false;
+        return isBlockType<T>(type);
     }
 };
 
-class MemoryMap {
-public:
-    int id;
+// Opciones de configuración del MemoryManager
+struct MemoryManagerOptions {
+    AllocatorPolicy policy = AllocatorPolicy::FIRST_FIT;
+    bool scalarSlabs = false; // Slabs de tamaño fijo para int, float y char
+    size_t compactionStepBytes = 0; // Bytes movidos por paso incremental (0 = compactar todo de una vez)
+    bool compactOnAllocate = true;  // false: allocate() nunca compacta (lo hace el planificador en segundo plano)
+    size_t compactionThreads = 1;   // Hilos para la compactación completa (0 = uno por núcleo)
+    size_t threadCacheBlocks = 0;   // Bloques que precorta cada caché por hilo en un lote (0 = sin cachés)
+    ArenaOptions arena;             // malloc o mmap, páginas grandes y pre-carga
+    bool inlineScalars = false;     // Valores escalares de hasta 8 bytes en los metadatos, sin arena
+    bool cacheLineAlignment = false; // Todos los bloques del arena empiezan en una línea de caché
+    size_t maxSizeMB = 0;           // Límite al crecer con chunks nuevos (0 = tamaño fijo; buddy no crece y lo ignora)
+    size_t chunkSizeMB = 0;         // Tamaño de cada chunk nuevo (0 = el tamaño inicial)
+    bool lazyPageRelease = false;   // scavenge() usa MADV_FREE en vez de MADV_DONTNEED
+};
+
+// Contadores que usa el planificador de compactación
+struct AllocationCounters {
+    size_t allocations = 0; // Llamadas a allocate()
+    size_t failures = 0;    // Veces que no hubo hueco a la primera
+    size_t frees = 0;       // Bloques liberados
+};
+
+// Entradas de las operaciones por lotes (allocateBatch, getValues,
+// setValues, applyRefDeltas)
+struct BlockSpec {
     size_t size;
-    std::string type;
-    int refcount;
-    MemoryBlock block;
-    bool initialized;
+    BlockType type;
+};
+
+// Bytes crudos del valor (o el texto, si es string) y el tipo que espera el llamador
+struct BlockWrite {
+    int id;
+    BlockType type;
+    std::string bytes;
+};
+
+struct BlockValue {
+    BlockType type = BlockType::INT;
+    std::string bytes;
+};
+
+struct RefDelta {
+    int id;
+    int delta; // Positivo suma referencias, negativo las quita
+};
 
+// Resultado de una entrada de un lote; un error no aborta el resto
+template <typename T>
+struct BatchResult {
+    T value{};
+    std::string error; // Vacío si la entrada salió bien
 
-    MemoryMap(int id, size_t size, void* address, std::string type = "int")
-        : block(address, size, type), id(id), size(size), type(type), refcount(1), initialized(true) {}
+    bool ok() const { return error.empty(); }
 };
 
 class MemoryManagerProgram {
-    size_t totalMemory;
-    std::vector<MemoryMap> memoryTable;
-    char* memory;
-    
+    static constexpr size_t kMaxBlocksPerCompactionStep = 256;
+    static constexpr size_t kMinBytesPerCompactionThread = 4 * 1024 * 1024;
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kMaxCachedBlockSize = 256;
+    static constexpr size_t kChunkGuardBytes = 64; // Separa chunks para que el asignador no los fusione
+    static constexpr size_t kCacheLineBytes = 64;
+    static constexpr size_t kMaxBlockAlignment = 4096;
+
+    // Los metadatos de bloques se reparten por slot del ID en shards independientes.
+    // Get/Set sobre bloques de shards distintos no compiten entre sí; sólo
+    // los cambios del asignador (allocate, liberar, compactar) se serializan
+    // en allocMutex. Orden de locks:
+    //   allocMutex -> ThreadCache::mutex -> addressMutex -> shards en orden de índice
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        BlockTable table{kShardCount};
+    };
+
+    // Copia de los metadatos de un bloque no string y de sus primeros 8 bytes,
+    // para que Get lea sin locks. Se escribe con el lock exclusivo del shard
+    // del slot; el lector reintenta si `sequence` es impar o cambió mientras
+    // leía (seqlock).
+    struct PublishedBlock {
+        std::atomic<uint32_t> sequence{0};
+        std::atomic<int32_t> id{-1}; // -1 si el slot no tiene un bloque publicado
+        std::atomic<BlockType> type{BlockType::INT};
+        std::atomic<uint32_t> size{0}; // Bytes copiados en value (hasta 8)
+        std::atomic<uint64_t> value{0};
+    };
+
+    // Bloque ya quitado de las tablas que vuelve al asignador (o a su slab)
+    struct FreedBlock {
+        char* address;
+        size_t size;
+        BlockType type;
+        bool inSlab;
+    };
+
+    // Bloque ya cortado (o inline) con su ID reservado, antes de entrar a su
+    // shard; `index` es su posición en el lote
+    struct CarvedBlock {
+        size_t index;
+        int id;
+        char* address;
+        size_t size;
+        BlockType type;
+        size_t alignment;
+        bool inSlab;
+        bool inlined;
+    };
+
+    // Caché de bloques precortados de un hilo, por tamaño exacto. Sólo la usa
+    // su hilo, salvo la compactación que la vacía; el mutex casi nunca compite.
+    struct ThreadCache {
+        std::mutex mutex;
+        std::unordered_map<size_t, std::vector<char*>> bins; // Tamaño -> direcciones libres
+    };
+
+    // Enlace de las cachés thread_local con su manager. El destructor del
+    // manager lo corta (manager = nullptr) bajo su mutex; un hilo que termina
+    // lo usa para devolver su caché mientras el manager siga vivo.
+    struct CacheOwner {
+        std::mutex mutex;
+        MemoryManagerProgram* manager;
+    };
+
+    // Cachés del hilo actual, una por manager. Al terminar el hilo cada una
+    // vuelve a su manager; si éste ya no existe no hay nada que devolver.
+    struct LocalCaches {
+        struct Entry {
+            ThreadCache* cache;
+            std::weak_ptr<CacheOwner> owner; // Vence al destruirse el manager
+        };
+        std::unordered_map<uint64_t, Entry> entries; // instanceId -> caché
+
+        ~LocalCaches() {
+            for (auto& [instance, entry] : entries) {
+                std::shared_ptr<CacheOwner> owner = entry.owner.lock();
+                if (!owner) continue;
+                std::lock_guard<std::mutex> lock(owner->mutex);
+                if (owner->manager) owner->manager->releaseThreadCache(entry.cache);
+            }
+        }
+    };
+
+    // Pedazo de memoria mapeado por separado; chunks[0] es el arena inicial
+    // y nunca se libera, el resto se agrega al crecer
+    struct Chunk {
+        std::unique_ptr<Arena> arena;
+        char* base;
+        size_t size; // Bytes entregados al asignador (sin el separador)
+    };
+
+    size_t totalMemory; // Suma de los chunks; protegido por allocMutex
+    size_t maxMemory;
+    size_t chunkBytes;
+    ArenaOptions arenaOptions;
+    std::vector<Chunk> chunks;
+    Shard shards[kShardCount];
+    BlockIdAllocator blockIds;
+    SlotChunks<PublishedBlock> published; // Vista sin locks de los bloques no string, por slot
+    std::map<char*, int> blocksByAddress; // Bloques fuera de slabs ordenados por dirección
+    std::mutex addressMutex;              // Protege blocksByAddress
+    std::unique_ptr<FreeSpaceAllocator> allocator;
+    std::unordered_map<BlockType, std::unique_ptr<SlabAllocator>> slabs; // Tipo -> slab
+    size_t compactionStepBytes;
+    bool compactOnAllocate;
+    size_t compactionThreads;
+    size_t threadCacheBlocks;
+    std::vector<std::unique_ptr<ThreadCache>> threadCaches; // Una por hilo vivo que asignó o liberó
+    std::mutex threadCachesMutex;                           // Protege el registro de cachés
+    std::shared_ptr<CacheOwner> cacheOwner;                 // Lo comparten las cachés thread_local (débil)
+    uint64_t instanceId;                                    // Clave de las cachés thread_local
+    std::atomic<size_t> allocationCount{0};
+    std::atomic<size_t> failureCount{0};
+    std::atomic<size_t> freeCount{0};
+    bool compactionPending = false;   // Una asignación falló y la compactación incremental no terminó
+    char* compactionCursor = nullptr; // Próximo bloque a bajar está por debajo de esta dirección
+    size_t compactionBytesMoved = 0;  // Total de bytes movidos por compactación
+    size_t compactionSteps = 0;       // Pasos incrementales ejecutados
+    bool lazyPageRelease;
+    bool inlineScalars;
+    bool cacheLineAlignment;
+    std::map<char*, size_t> scavengedRanges; // Páginas devueltas en la última pasada
+    size_t scavengeAllocations = 0;          // allocationCount en la última pasada
+    size_t scavengedBytes = 0;               // Total devuelto al sistema
+    std::string dumpFolder = ".";
+    std::mutex dumpMutex;
+    mutable std::mutex allocMutex; // Protege asignador, slabs y estado de compactación
 
 public:
-    MemoryManagerProgram(size_t sizeMB) {
+    MemoryManagerProgram(size_t sizeMB, AllocatorPolicy policy = AllocatorPolicy::FIRST_FIT)
+        : MemoryManagerProgram(sizeMB, optionsWithPolicy(policy)) {}
+
+    MemoryManagerProgram(size_t sizeMB, const MemoryManagerOptions& options)
+        : compactionStepBytes(options.compactionStepBytes), compactOnAllocate(options.compactOnAllocate),
+          compactionThreads(options.compactionThreads > 0 ? options.compactionThreads
+                                                          : std::max(1u, std::thread::hardware_concurrency())),
+          threadCacheBlocks(options.threadCacheBlocks), lazyPageRelease(options.lazyPageRelease),
+          inlineScalars(options.inlineScalars), cacheLineAlignment(options.cacheLineAlignment) {
+        static std::atomic<uint64_t> nextInstanceId{1};
+        instanceId = nextInstanceId++;
+        cacheOwner = std::make_shared<CacheOwner>();
+        cacheOwner->manager = this;
         totalMemory = sizeMB * 1'000'000; // Convert MB to Bytes
-        memory = (char*)std::malloc(totalMemory);
-        if (!memory) {
-            throw std::bad_alloc();
+        maxMemory = std::max(totalMemory, options.maxSizeMB * 1'000'000);
+        chunkBytes = options.chunkSizeMB > 0 ? options.chunkSizeMB * 1'000'000 : totalMemory;
+        arenaOptions = options.arena;
+
+        // Sólo un arena que puede crecer necesita el separador entre chunks
+        size_t guard = maxMemory > totalMemory ? kChunkGuardBytes : 0;
+        auto arena = std::make_unique<Arena>(totalMemory + guard, arenaOptions);
+        char* memory = arena->data();
+        chunks.push_back({std::move(arena), memory, totalMemory});
+        allocator = createAllocator(options.policy);
+        allocator->reset({{memory, totalMemory}});
+
+        if (options.scalarSlabs) {
+            for (BlockType type : {BlockType::INT, BlockType::FLOAT, BlockType::CHAR}) {
+                slabs[type] = std::make_unique<SlabAllocator>(allocator.get(), blockTypeSize(type));
+            }
         }
-        freeList.push_back({memory, totalMemory});
     }
 
     ~MemoryManagerProgram() {
-        std::free(memory);
+        // Los hilos que terminen desde ahora ya no le devuelven sus cachés
+        std::lock_guard<std::mutex> lock(cacheOwner->mutex);
+        cacheOwner->manager = nullptr;
     }
+
+    void setDumpFolder(const std::string& folder) {
+        dumpFolder = folder;
+    }
+
     void generateDump(const std::string& operation) {
         std::lock_guard<std::mutex> lock(dumpMutex);
+        std::lock_guard<std::mutex> allocLock(allocMutex);
+        size_t cachedBlocks = countCachedBlocks();
+        std::vector<std::shared_lock<std::shared_mutex>> shardLocks;
+        for (auto& shard : shards) shardLocks.emplace_back(shard.mutex);
         auto now = std::chrono::system_clock::now();
         auto in_time_t = std::chrono::system_clock::to_time_t(now);
 
@@ -138,240 +352,1209 @@ public:
         dumpFile << "Operation: " << operation << "\n";
         dumpFile << "Timestamp: " << std::put_time(std::localtime(&in_time_t), "%c") << "\n";
         dumpFile << "Total Memory: " << (totalMemory / (1024 * 1024)) << " MB\n";
+        dumpFile << "Allocator: " << allocator->name() << "\n";
+        dumpFile << "Arena: " << chunks.front().arena->describe() << "\n";
+        if (maxMemory > chunks.front().size) {
+            dumpFile << "Chunks: " << chunks.size()
+                     << " | Max Memory: " << (maxMemory / (1024 * 1024)) << " MB\n";
+            for (const auto& chunk : chunks) {
+                dumpFile << "  Base: " << static_cast<void*>(chunk.base)
+                         << " | Size: " << chunk.size << " bytes\n";
+            }
+        }
+        dumpFile << "ID slots: " << blockIds.slotCount() << " | Live IDs: " << blockIds.liveCount()
+                 << " | Retired slots: " << blockIds.retiredCount() << "\n";
         dumpFile << "Memory Blocks:\n";
 
-        for (const auto& block : memoryTable) {
-            dumpFile << "  ID: " << block.id
-                    << " | Type: " << block.type
-                    << " | Size: " << block.size << " bytes"
-                    << " | Refs: " << block.refcount
-                    << " | Addr: " << block.block.address << "\n";
+        for (const auto& shard : shards) {
+            const BlockTable& table = shard.table;
+            for (size_t pos = 0; pos < table.size(); ++pos) {
+                dumpFile << "  ID: " << table.ids[pos]
+                        << " | Type: " << blockTypeName(table.types[pos])
+                        << " | Size: " << table.sizes[pos] << " bytes"
+                        << " | Refs: " << table.refcounts[pos].value.load()
+                        << " | Addr: ";
+                if (table.isInline(pos)) dumpFile << "inline\n";
+                else dumpFile << table.addresses[pos] << "\n";
+            }
         }
 
         dumpFile << "Free Blocks:\n";
-        for (const auto& freeBlock : freeList) {
+        for (const auto& freeBlock : allocator->freeBlocks()) {
             dumpFile << "  Addr: " << freeBlock.address
                     << " | Size: " << freeBlock.size << " bytes\n";
         }
+        dumpFile << "Free Memory: " << allocator->totalFreeBytes() << " bytes"
+                 << " | Largest free block: " << allocator->largestFreeBlock() << " bytes"
+                 << " | Fragmentation: " << std::fixed << std::setprecision(2)
+                 << allocator->fragmentation() * 100.0 << "%\n";
+        dumpFile << "Alignment padding: " << allocator->paddingBytes() << " bytes\n";
+        dumpFile << "Compaction: " << compactionBytesMoved << " bytes moved"
+                 << " | Incremental steps: " << compactionSteps << "\n";
+        dumpFile << "Scavenged: " << scavengedBytes << " bytes"
+                 << " | Resident: " << residentBytesLocked() << " bytes\n";
+        if (threadCacheBlocks > 0) {
+            dumpFile << "Thread caches: " << cachedBlocks << " blocks\n";
+        }
+        allocator->writeStats(dumpFile);
+
+        if (!slabs.empty()) {
+            dumpFile << "Slabs:\n";
+            for (const auto& [type, slab] : slabs) {
+                dumpFile << "  Type: " << blockTypeName(type)
+                         << " | Pages: " << slab->getPages().size()
+                         << " | Used slots: " << slab->getUsedSlots() << "/" << slab->getCapacity() << "\n";
+            }
+        }
 
         dumpFile.close();
     }
 
 
     // Asigna memoria para un tipo específico
-    int allocate(size_t size, std::string type = "int") {
-        static int nextId = 1;
+    int allocate(size_t size, const std::string& type = "int") {
+        return allocate(size, parseBlockType(type));
+    }
 
-        // Verificar tamaño mínimo según el tipo
-        size_t minSize = getMinSizeForType(type);
-        if (size < minSize) {
-            throw std::runtime_error("Tamaño muy pequeño para el tipo " + type);
+    int allocate(size_t size, BlockType type) {
+        return allocate(size, type, 1);
+    }
+
+    // Asigna un bloque alineado al menos a `alignment` (potencia de dos),
+    // p.ej. una línea de caché para un bloque muy usado. Nunca queda por
+    // debajo de la alineación natural del tipo.
+    int allocate(size_t size, BlockType type, size_t alignment) {
+        allocationCount++;
+        alignment = checkAllocation(size, type, alignment);
+
+        // El ID se reserva antes de cortar: si no quedan, el Create falla
+        // como sin memoria y sin tocar el arena
+        int id = blockIds.acquire();
+        if (id == -1) return -1;
+
+        // Un escalar chico no usa el arena: su valor vive en los metadatos
+        if (isInlinable(size, type)) {
+            return registerBlock(id, size, nullptr, type, 1, false, true);
         }
 
-        void* addr = findFreeSpace(size);
+        // Camino rápido: un bloque precortado de la caché del hilo, sin allocMutex
+        alignment = carveAlignment(size, type, alignment);
+        if (isCacheable(size, type, alignment)) {
+            ThreadCache& cache = localCache();
+            for (int attempt = 0; attempt < 2; ++attempt) {
+                {
+                    std::lock_guard<std::mutex> cacheLock(cache.mutex);
+                    std::vector<char*>& bin = cache.bins[size];
+                    if (!bin.empty()) {
+                        char* addr = bin.back();
+                        bin.pop_back();
+                        // Se registra con la caché tomada para que la compactación no lo pierda de vista
+                        return registerBlock(id, size, addr, type, alignment, false);
+                    }
+                }
+                if (!refillCache(cache, size)) break;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(allocMutex);
+        bool inSlab = false;
+        void* addr = carve(size, type, alignment, inSlab);
         if (!addr) {
-            compactMemory();
-            addr = findFreeSpace(size);
-            if (!addr) return -1;
+            addr = makeRoomAndCarveLocked(size, type, alignment, inSlab);
+            if (!addr) {
+                blockIds.cancel(id);
+                return -1;
+            }
+        } else if (compactionPending) {
+            compactionPending = compactStepLocked(compactionStepBytes);
         }
 
-        memoryTable.push_back(MemoryMap(nextId, size, addr, type));
-        return nextId++;
+        // El bloque entra a su shard antes de soltar allocMutex para que la
+        // compactación nunca vea una dirección sin su entrada en la tabla
+        return registerBlock(id, size, static_cast<char*>(addr), type, alignment, inSlab);
     }
 
-    // Obtiene el tipo de un bloque (versión const)
-    std::string getBlockType(int id) const {
-        for (const auto& block : memoryTable) {
-            if (block.id == id) {
-                return block.type;
-            }
+    // Bytes de arena mapeados ahora mismo (crece y se achica con los chunks)
+    size_t getTotalMemory() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return totalMemory;
+    }
+
+    size_t getChunkCount() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return chunks.size();
+    }
+
+    // Cachés registradas: una por hilo vivo que usó las cachés
+    size_t getThreadCacheCount() {
+        std::lock_guard<std::mutex> lock(threadCachesMutex);
+        return threadCaches.size();
+    }
+
+    // Devuelve al sistema los chunks agregados que quedaron vacíos
+    void releaseEmptyChunks() {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        releaseEmptyChunksLocked();
+    }
+
+    // Devuelve al sistema las páginas enteras dentro de huecos libres de al
+    // menos `minBytes`; el contenido de esos huecos se pierde, pero ningún
+    // bloque vivo vive ahí. Devuelve los bytes liberados en esta pasada.
+    size_t scavenge(size_t minBytes) {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        size_t pageBytes = chunks.front().arena->pageSize();
+        minBytes = std::max(minBytes, pageBytes);
+
+        // Si no hubo asignaciones desde la pasada anterior, los rangos que ya
+        // se devolvieron no volvieron a tocarse
+        bool untouched = allocationCount.load() == scavengeAllocations;
+        scavengeAllocations = allocationCount.load();
+
+        std::map<char*, size_t> released;
+        size_t bytes = 0;
+        for (const auto& block : allocator->freeBlocks()) {
+            uintptr_t start = reinterpret_cast<uintptr_t>(block.address);
+            uintptr_t begin = (start + pageBytes - 1) / pageBytes * pageBytes;
+            uintptr_t end = (start + block.size) / pageBytes * pageBytes;
+            if (end <= begin || end - begin < minBytes) continue;
+
+            char* addr = reinterpret_cast<char*>(begin);
+            size_t length = end - begin;
+            released.emplace(addr, length);
+            auto previous = scavengedRanges.find(addr);
+            if (untouched && previous != scavengedRanges.end() && previous->second == length) continue;
+            if (chunkOf(addr).arena->releasePages(addr, length, lazyPageRelease)) bytes += length;
         }
-        throw std::runtime_error("ID no encontrado");
+        scavengedRanges.swap(released);
+        scavengedBytes += bytes;
+        return bytes;
     }
 
-    // Obtiene la dirección de un bloque (versión const)
+    // Bytes del arena (todos los chunks) en memoria física
+    size_t getResidentBytes() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return residentBytesLocked();
+    }
+
+    // Obtiene el tipo de un bloque (versión const)
+    BlockType getBlockType(int id) const {
+        const Shard& shard = shardOf(id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.table.types[shard.table.find(id)];
+    }
+
+    // Obtiene la dirección de un bloque en el arena (nullptr si es inline)
     void* getBlockAddress(int id) const {
-        for (const auto& block : memoryTable) {
-            if (block.id == id) {
-                return block.block.address;
-            }
-        }
-        throw std::runtime_error("ID no encontrado");
+        const Shard& shard = shardOf(id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        size_t pos = shard.table.find(id);
+        return shard.table.isInline(pos) ? nullptr : shard.table.addresses[pos];
     }
 
     // Obtiene el tamaño de un bloque (versión const)
     size_t getBlockSize(int id) const {
-        for (const auto& block : memoryTable) {
-            if (block.id == id) {
-                return block.size;
-            }
-        }
-        throw std::runtime_error("ID no encontrado");
+        const Shard& shard = shardOf(id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.table.sizes[shard.table.find(id)];
     }
 
     // Asigna un valor a un bloque
     template <typename T>
     void setValue(int id, const T& value) {
-        for (auto& block : memoryTable) {
-            if (block.id == id) {
-                if constexpr (std::is_same_v<T, std::string>) {
-                    if (block.type != "string") {
-                        throw std::runtime_error("El bloque no es de tipo string");
-                    }
-                    block.block.setStringValue(value);
-                } else {
-                    if (!std::is_pod_v<T>) {
-                        throw std::runtime_error("Solo soporta tipos string y pod");
-                    }
-                    block.block.setValue(value);
-                }
-                block.initialized = true;
-                return;
+        Shard& shard = shardOf(id);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        size_t pos = shard.table.find(id);
+        MemoryBlock block = blockAt(shard.table, pos);
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (block.type != BlockType::STRING) {
+                throw std::runtime_error("El bloque no es de tipo string");
+            }
+            block.setStringValue(value);
+        } else {
+            if (!std::is_pod_v<T>) {
+                throw std::runtime_error("Solo soporta tipos string y pod");
             }
+            block.setValue(value);
+            publish(id, block);
         }
-        throw std::runtime_error("ID no encontrado");
+        shard.table.flags[pos] |= BlockTable::kInitialized;
     }
 
     // Obtiene un valor de un bloque (versión const)
     template <typename T>
     T getValue(int id) const {
-        for (const auto& block : memoryTable) {
-            if (block.id == id) {
-                if (!block.initialized) {
+        // Camino rápido para escalares: sin locks, desde la copia publicada
+        if constexpr (!std::is_same_v<T, std::string> && std::is_pod_v<T> && sizeof(T) <= sizeof(uint64_t)) {
+            T value;
+            if (readPublished(id, value)) return value;
+        }
+
+        const Shard& shard = shardOf(id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        size_t pos = shard.table.find(id);
+        if (!shard.table.initialized(pos)) {
+            throw std::runtime_error("Intento de leer bloque in inicializar");
+        }
+        const MemoryBlock block = blockAt(shard.table, pos);
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (block.type != BlockType::STRING) {
+                throw std::runtime_error("el bloque no es de tipo string");
+            }
+            return block.getStringValue();
+        } else {
+            if (!std::is_pod_v<T>) {
+                throw std::runtime_error("Solo soporta tipos string y pod");
+            }
+            return block.getValue<T>();
+        }
+    }
+
+    // Incrementa el contador de referencias
+    // Los contadores son atómicos: basta el lock compartido del shard (que
+    // sólo impide que la entrada se mueva), sin pasar por allocMutex
+    int increaseRefCount(int id) {
+        Shard& shard = shardOf(id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        std::atomic<int32_t>& refcount = shard.table.refcounts[shard.table.find(id)].value;
+        int current = refcount.load();
+        do {
+            // Un bloque en 0 ya está siendo liberado y no se puede revivir
+            if (current == 0) throw std::runtime_error("ID no encontrado");
+        } while (!refcount.compare_exchange_weak(current, current + 1));
+        return current + 1;
+    }
+
+    // Decrementa el contador de referencias
+    int decreaseRefCount(int id) {
+        Shard& shard = shardOf(id);
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            std::atomic<int32_t>& refcount = shard.table.refcounts[shard.table.find(id)].value;
+            int current = refcount.load();
+            do {
+                if (current == 0) throw std::runtime_error("ID no encontrado");
+            } while (!refcount.compare_exchange_weak(current, current - 1));
+            if (current > 1) return current - 1;
+        }
+
+        // Este hilo hizo la transición a 0 y es el único que libera el bloque
+        freeCount++;
+        freeMemory(id);
+        return 0;
+    }
+
+    // Operaciones por lotes: cada una toma allocMutex, addressMutex y los
+    // shards que toca una sola vez para todo el lote, en vez de una vez por
+    // bloque. El error de una entrada queda en su resultado y no aborta el resto.
+
+    // Asigna varios bloques; el valor de cada resultado es el ID (-1 si no hubo memoria)
+    std::vector<BatchResult<int>> allocateBatch(const std::vector<BlockSpec>& specs) {
+        allocationCount += specs.size();
+        std::vector<BatchResult<int>> results(specs.size());
+        std::vector<CarvedBlock> carved;
+
+        std::lock_guard<std::mutex> lock(allocMutex);
+        bool failed = false;
+        for (size_t i = 0; i < specs.size(); ++i) {
+            results[i].value = -1;
+            const BlockSpec& spec = specs[i];
+            size_t alignment;
+            try {
+                alignment = carveAlignment(spec.size, spec.type, checkAllocation(spec.size, spec.type, 1));
+            } catch (const std::exception& e) {
+                results[i].error = e.what();
+                continue;
+            }
+            int id = blockIds.acquire();
+            if (id == -1) {
+                results[i].error = "No quedan IDs de bloque disponibles";
+                continue;
+            }
+
+            if (isInlinable(spec.size, spec.type)) {
+                carved.push_back({i, id, nullptr, spec.size, spec.type, 1, false, true});
+                continue;
+            }
+
+            bool inSlab = false;
+            void* addr = carve(spec.size, spec.type, alignment, inSlab);
+            if (!addr) {
+                // Compactar mueve bloques: los ya cortados tienen que estar registrados antes
+                failed = true;
+                registerBlocks(carved, results);
+                carved.clear();
+                addr = makeRoomAndCarveLocked(spec.size, spec.type, alignment, inSlab);
+                if (!addr) {
+                    blockIds.cancel(id);
+                    results[i].error = "Memoria insuficiente";
+                    continue;
+                }
+            }
+            carved.push_back({i, id, static_cast<char*>(addr), spec.size, spec.type, alignment, inSlab, false});
+        }
+        registerBlocks(carved, results);
+        if (!failed && compactionPending) {
+            compactionPending = compactStepLocked(compactionStepBytes);
+        }
+        return results;
+    }
+
+    // Lee varios bloques; los escalares vuelven con sus bytes crudos
+    std::vector<BatchResult<BlockValue>> getValues(const std::vector<int>& ids) const {
+        std::vector<BatchResult<BlockValue>> results(ids.size());
+        auto locks = lockShards<std::shared_lock<std::shared_mutex>>(shardMask(ids));
+        for (size_t i = 0; i < ids.size(); ++i) {
+            try {
+                const BlockTable& table = shardOf(ids[i]).table;
+                size_t pos = table.find(ids[i]);
+                if (!table.initialized(pos)) {
                     throw std::runtime_error("Intento de leer bloque in inicializar");
                 }
-                if constexpr (std::is_same_v<T, std::string>) {
-                    if (block.type != "string") {
-                        throw std::runtime_error("el bloque no es de tipo string");
-                    }
-                    return block.block.getStringValue();
+                const MemoryBlock block = blockAt(table, pos);
+                results[i].value.type = block.type;
+                if (block.type == BlockType::STRING) {
+                    results[i].value.bytes = block.getStringValue();
                 } else {
-                    if (!std::is_pod_v<T>) {
-                        throw std::runtime_error("Solo soporta tipos string y pod");
-                    }
-                    return block.block.getValue<T>();
+                    results[i].value.bytes.assign(static_cast<const char*>(block.address), blockTypeSize(block.type));
                 }
+            } catch (const std::exception& e) {
+                results[i].error = e.what();
             }
         }
-        throw std::runtime_error("ID no encontrado");
+        return results;
     }
 
-    // Incrementa el contador de referencias
-    int increaseRefCount(int id) {
-        for (auto& block : memoryTable) {
-            if (block.id == id) {
-                return ++block.refcount;
+    // Escribe varios bloques; el valor de cada resultado son los bytes escritos
+    std::vector<BatchResult<size_t>> setValues(const std::vector<BlockWrite>& writes) {
+        std::vector<BatchResult<size_t>> results(writes.size());
+        std::vector<int> ids;
+        for (const auto& write : writes) ids.push_back(write.id);
+        auto locks = lockShards<std::unique_lock<std::shared_mutex>>(shardMask(ids));
+        for (size_t i = 0; i < writes.size(); ++i) {
+            const BlockWrite& write = writes[i];
+            try {
+                BlockTable& table = shardOf(write.id).table;
+                size_t pos = table.find(write.id);
+                MemoryBlock block = blockAt(table, pos);
+                if (block.type != write.type) {
+                    throw std::runtime_error("Tipo de dato incorrecto para este bloque");
+                }
+                if (block.type == BlockType::STRING) {
+                    block.setStringValue(write.bytes);
+                } else {
+                    if (write.bytes.size() != blockTypeSize(block.type)) {
+                        throw std::runtime_error("Tamaño del dato no corresponde al tipo del bloque");
+                    }
+                    std::memcpy(block.address, write.bytes.data(), write.bytes.size());
+                    publish(write.id, block);
+                }
+                table.flags[pos] |= BlockTable::kInitialized;
+                results[i].value = write.bytes.size();
+            } catch (const std::exception& e) {
+                results[i].error = e.what();
             }
         }
-        throw std::runtime_error("ID no encontrado");
+        return results;
     }
 
-    // Decrementa el contador de referencias
-    int decreaseRefCount(int id) {
-        for (auto& block : memoryTable) {
-            if (block.id == id) {
-                if (--block.refcount == 0) {
-                    freeMemory(id);
-                    return 0;
+    // Suma `delta` al contador de varios bloques; el valor de cada resultado
+    // es el contador nuevo. Los que llegan a 0 se liberan juntos al final.
+    std::vector<BatchResult<int>> applyRefDeltas(const std::vector<RefDelta>& deltas) {
+        std::vector<BatchResult<int>> results(deltas.size());
+        std::vector<int> released;
+        {
+            std::vector<int> ids;
+            for (const auto& delta : deltas) ids.push_back(delta.id);
+            auto locks = lockShards<std::shared_lock<std::shared_mutex>>(shardMask(ids));
+            for (size_t i = 0; i < deltas.size(); ++i) {
+                try {
+                    BlockTable& table = shardOf(deltas[i].id).table;
+                    std::atomic<int32_t>& refcount = table.refcounts[table.find(deltas[i].id)].value;
+                    int32_t current = refcount.load();
+                    int64_t next;
+                    do {
+                        if (current == 0) throw std::runtime_error("ID no encontrado");
+                        // El delta viene del cliente: sumar en 64 bits para que no desborde
+                        next = int64_t(current) + deltas[i].delta;
+                        if (next < 0) throw std::runtime_error("El contador de referencias quedaría negativo");
+                        if (next > INT32_MAX) throw std::runtime_error("El contador de referencias se desbordaría");
+                    } while (!refcount.compare_exchange_weak(current, static_cast<int32_t>(next)));
+                    results[i].value = static_cast<int>(next);
+                    if (next == 0) released.push_back(deltas[i].id);
+                } catch (const std::exception& e) {
+                    results[i].error = e.what();
                 }
-                return block.refcount;
             }
         }
-        throw std::runtime_error("ID no encontrado");
+
+        if (!released.empty()) {
+            freeCount += released.size();
+            freeMemoryBatch(released);
+        }
+        return results;
     }
 
     // Compacta la memoria
     void compactMemory() {
-        std::sort(memoryTable.begin(), memoryTable.end(), [](const MemoryMap& a, const MemoryMap& b) {
-            return a.block.address < b.block.address;
+        std::lock_guard<std::mutex> lock(allocMutex);
+        compactMemoryLocked();
+        releaseEmptyChunksLocked();
+    }
+
+    // Paso de compactación incremental: recorre los bloques de la dirección
+    // más alta a la más baja y baja cada uno al hueco que le dé el asignador,
+    // moviendo como mucho `maxBytes` y visitando como mucho
+    // kMaxBlocksPerCompactionStep bloques. El espacio libre se va juntando al
+    // final del arena sin detener todo el proceso. Devuelve false cuando el
+    // recorrido terminó (o la política no admite mover bloques).
+    bool compactStep(size_t maxBytes) {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        if (compactStepLocked(maxBytes)) return true;
+        releaseEmptyChunksLocked();
+        return false;
+    }
+
+    double fragmentation() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return allocator->fragmentation();
+    }
+
+    bool supportsCompaction() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return allocator->supportsCompaction();
+    }
+
+    AllocationCounters getAllocationCounters() const {
+        AllocationCounters counters;
+        counters.allocations = allocationCount.load();
+        counters.failures = failureCount.load();
+        counters.frees = freeCount.load();
+        return counters;
+    }
+
+    size_t getCompactionBytesMoved() const {
+        std::lock_guard<std::mutex> lock(allocMutex);
+        return compactionBytesMoved;
+    }
+
+    // Acceso directo al asignador para inspección; no es thread-safe
+    const FreeSpaceAllocator& getAllocator() const {
+        return *allocator;
+    }
+
+    const Arena& getArena() const {
+        return *chunks.front().arena;
+    }
+
+    const SlabAllocator* getSlab(const std::string& type) const {
+        auto it = slabs.find(parseBlockType(type));
+        return it == slabs.end() ? nullptr : it->second.get();
+    }
+
+private:
+    // Opciones por defecto salvo la política de asignación
+    static MemoryManagerOptions optionsWithPolicy(AllocatorPolicy policy) {
+        MemoryManagerOptions opts;
+        opts.policy = policy;
+        return opts;
+    }
+
+    // Las versiones *Locked asumen que el llamador ya tiene allocMutex y
+    // ningún otro lock; ellas toman los que necesiten
+    void compactMemoryLocked() {
+        if (!allocator->supportsCompaction()) return;
+
+        // Los bloques precortados no están en ninguna tabla: si siguieran en
+        // las cachés la compactación los pisaría. Las cachés quedan tomadas
+        // hasta el final para que ningún hilo libere un bloque hacia ellas
+        // entre el vaciado y el recorrido de las tablas.
+        std::lock_guard<std::mutex> registryLock(threadCachesMutex);
+        std::vector<std::unique_lock<std::mutex>> cacheLocks;
+        for (auto& cache : threadCaches) {
+            cacheLocks.emplace_back(cache->mutex);
+            drainCache(*cache);
+        }
+
+        // Mover bloques cambia direcciones que leen Get/Set: se bloquean todos los shards
+        std::lock_guard<std::mutex> addressLock(addressMutex);
+        std::vector<std::unique_lock<std::shared_mutex>> shardLocks;
+        for (auto& shard : shards) shardLocks.emplace_back(shard.mutex);
+
+        for (auto& [type, slab] : slabs) slab->releaseEmptyPages();
+
+        // Se mueven bloques sueltos y páginas de slab completas; los bloques
+        // dentro de una página conservan su offset
+        // `slot` apunta a la entrada del arreglo de direcciones del bloque
+        struct Extent {
+            char* address;
+            size_t span;
+            size_t bytes;
+            size_t alignment;
+            void** slot;
+            int id;
+            SlabAllocator::Page* page;
+        };
+        struct SlabRef {
+            void** slot;
+            SlabAllocator::Page* page;
+            size_t offset;
+        };
+
+        std::vector<Extent> extents;
+        std::vector<SlabRef> slabRefs;
+        for (auto& shard : shards) {
+            BlockTable& table = shard.table;
+            for (size_t pos = 0; pos < table.size(); ++pos) {
+                if (table.isInline(pos)) continue;
+                char* addr = static_cast<char*>(table.addresses[pos]);
+                if (table.inSlab(pos)) {
+                    SlabAllocator::Page* page = slabs.at(table.types[pos])->pageOf(addr);
+                    slabRefs.push_back({&table.addresses[pos], page, static_cast<size_t>(addr - page->base)});
+                } else {
+                    // Cada bloque ocupa lo que la política le reservó, no sólo su tamaño pedido
+                    extents.push_back({addr, allocator->blockSpan(table.sizes[pos]), table.sizes[pos],
+                                       table.alignment(pos), &table.addresses[pos], table.ids[pos], nullptr});
+                }
+            }
+        }
+        for (auto& [type, slab] : slabs) {
+            for (const auto& page : slab->getPages()) {
+                extents.push_back({page->base, allocator->blockSpan(SlabAllocator::kPageSize),
+                                   SlabAllocator::kPageSize, SlabAllocator::kPageAlignment, nullptr, 0, page.get()});
+            }
+        }
+
+        std::sort(extents.begin(), extents.end(), [](const Extent& a, const Extent& b) {
+            return a.address < b.address;
         });
 
-        char* current = memory;
-        for (auto& block : memoryTable) {
-            if (block.block.address != current) {
-                std::memmove(current, block.block.address, block.size);
-                block.block.address = current;
+        // Cada chunk se divide en regiones contiguas que se compactan en
+        // paralelo. Cada región junta sus bloques al inicio de su propio tramo,
+        // así que los hilos nunca escriben en el tramo de otro; el resultado
+        // deja a lo sumo un hueco libre por región.
+        struct Region {
+            char* begin;
+            char* end;
+            bool lastInChunk;
+        };
+        std::vector<const Chunk*> orderedChunks;
+        for (const auto& chunk : chunks) orderedChunks.push_back(&chunk);
+        std::sort(orderedChunks.begin(), orderedChunks.end(), [](const Chunk* a, const Chunk* b) {
+            return a->base < b->base;
+        });
+        std::vector<Region> regionSpans;
+        for (const Chunk* chunk : orderedChunks) {
+            size_t pieces = std::min(compactionThreads,
+                                     std::max<size_t>(1, chunk->size / kMinBytesPerCompactionThread));
+            size_t pieceSize = chunk->size / pieces;
+            for (size_t p = 0; p < pieces; ++p) {
+                char* begin = chunk->base + p * pieceSize;
+                char* end = p + 1 == pieces ? chunk->base + chunk->size : begin + pieceSize;
+                regionSpans.push_back({begin, end, p + 1 == pieces});
             }
-            current += block.size;
         }
+        size_t regionCount = regionSpans.size();
 
-        freeList.clear();
-        if (current < memory + totalMemory) {
-            freeList.push_back({current, static_cast<size_t>(memory + totalMemory - current)});
+        // groupBegin[r] = primer extent (ordenado por dirección) que empieza en la región r
+        std::vector<size_t> groupBegin(regionCount + 1);
+        size_t nextRegion = 0;
+        size_t region = 0;
+        for (size_t i = 0; i < extents.size(); ++i) {
+            while (region + 1 < regionCount && extents[i].address >= regionSpans[region].end) region++;
+            while (nextRegion <= region) groupBegin[nextRegion++] = i;
         }
+        while (nextRegion <= regionCount) groupBegin[nextRegion++] = extents.size();
+
+        // Una región empieza donde termina el último bloque de las anteriores si éste cruza el límite
+        std::vector<char*> regionBase(regionCount);
+        for (size_t r = 0; r < regionCount; ++r) {
+            regionBase[r] = regionSpans[r].begin;
+            if (groupBegin[r] > 0) {
+                const Extent& previous = extents[groupBegin[r] - 1];
+                regionBase[r] = std::max(regionBase[r], previous.address + previous.span);
+            }
+        }
+
+        std::vector<char*> regionEnd(regionCount);
+        std::vector<size_t> regionMoved(regionCount, 0);
+        std::vector<std::vector<FreeBlock>> regionGaps(regionCount); // Huecos de alineación entre bloques
+        auto packRegion = [&](size_t r) {
+            char* current = regionBase[r];
+            for (size_t i = groupBegin[r]; i < groupBegin[r + 1]; ++i) {
+                Extent& extent = extents[i];
+                // Un bloque alineado nunca termina más arriba que antes. Si no lo
+                // estaba, subirlo pisaría al siguiente: se queda donde está.
+                char* aligned = std::min(alignUp(current, extent.alignment), extent.address);
+                if (aligned != current) {
+                    regionGaps[r].push_back({current, static_cast<size_t>(aligned - current)});
+                    current = aligned;
+                }
+                if (extent.address != current) {
+                    std::memmove(current, extent.address, extent.bytes);
+                    regionMoved[r] += extent.bytes;
+                }
+                if (extent.slot) *extent.slot = current;
+                else extent.page->base = current;
+                current += extent.span;
+            }
+            regionEnd[r] = current;
+        };
+
+        size_t workerCount = std::min(compactionThreads, regionCount);
+        if (workerCount == 1) {
+            for (size_t r = 0; r < regionCount; ++r) packRegion(r);
+        } else {
+            std::vector<std::thread> workers;
+            workers.reserve(workerCount);
+            for (size_t w = 0; w < workerCount; ++w) {
+                workers.emplace_back([&, w] {
+                    for (size_t r = w; r < regionCount; r += workerCount) packRegion(r);
+                });
+            }
+            for (auto& worker : workers) worker.join();
+        }
+
+        // Fase de corrección: direcciones dentro de slabs e índices por dirección
+        for (size_t moved : regionMoved) compactionBytesMoved += moved;
+        for (const auto& ref : slabRefs) {
+            *ref.slot = ref.page->base + ref.offset;
+        }
+        for (auto& [type, slab] : slabs) slab->rebuildIndex();
+
+        blocksByAddress.clear();
+        for (const auto& extent : extents) {
+            if (extent.slot) blocksByAddress.emplace(static_cast<char*>(*extent.slot), extent.id);
+        }
+        compactionPending = false;
+        compactionCursor = nullptr;
+
+        // Los únicos huecos de alineación que quedan son los que dejó el empaquetado
+        std::vector<FreeBlock> regions;
+        allocator->resetPadding();
+        for (size_t r = 0; r < regionCount; ++r) {
+            for (const auto& gap : regionGaps[r]) {
+                regions.push_back(gap);
+                allocator->recordPadding(static_cast<char*>(gap.address) + gap.size, gap.size);
+            }
+            char* next = regionSpans[r].lastInChunk ? regionSpans[r].end : regionBase[r + 1];
+            if (regionEnd[r] < next) {
+                regions.push_back({regionEnd[r], static_cast<size_t>(next - regionEnd[r])});
+            }
+        }
+        allocator->reset(regions);
     }
 
-private:
-    struct FreeBlock {
-        void* address;
-        size_t size;
-    };
+    bool compactStepLocked(size_t maxBytes) {
+        if (!allocator->supportsCompaction()) return false;
+        compactionSteps++;
+        std::lock_guard<std::mutex> addressLock(addressMutex);
+
+        size_t moved = 0;
+        size_t visited = 0;
+        while (moved < maxBytes && visited < kMaxBlocksPerCompactionStep) {
+            auto it = compactionCursor ? blocksByAddress.lower_bound(compactionCursor) : blocksByAddress.end();
+            if (it == blocksByAddress.begin()) {
+                compactionCursor = nullptr;
+                return false;
+            }
+            --it;
+            visited++;
 
-    std::vector<FreeBlock> freeList;
+            char* oldAddr = it->first;
+            compactionCursor = oldAddr;
+            // Sólo se detiene el shard del bloque que se mueve
+            int id = it->second;
+            Shard& shard = shardOf(id);
+            std::unique_lock<std::shared_mutex> shardLock(shard.mutex);
+            size_t pos = shard.table.find(id);
+            size_t size = shard.table.sizes[pos];
 
-    // Encuentra espacio libre
-    void* findFreeSpace(size_t size) {
-        for (auto it = freeList.begin(); it != freeList.end(); ++it) {
-            if (it->size >= size) {
-                void* addr = it->address;
-                if (it->size > size) {
-                    it->address = static_cast<char*>(it->address) + size;
-                    it->size -= size;
-                } else {
-                    freeList.erase(it);
+            char* newAddr = static_cast<char*>(allocator->allocateAligned(size, shard.table.alignment(pos)));
+            if (!newAddr) {
+                compactionCursor = nullptr;
+                return false;
+            }
+            if (newAddr > oldAddr) {
+                allocator->release(newAddr, size);
+                continue;
+            }
+
+            // El hueco nuevo y la posición vieja nunca se solapan
+            std::memcpy(newAddr, oldAddr, size);
+            shard.table.addresses[pos] = newAddr;
+            blocksByAddress.erase(it);
+            blocksByAddress.emplace(newAddr, id);
+            allocator->release(oldAddr, size);
+
+            moved += size;
+            compactionBytesMoved += size;
+        }
+        return true;
+    }
+
+    Shard& shardOf(int id) {
+        return shards[blockSlot(id) % kShardCount];
+    }
+
+    const Shard& shardOf(int id) const {
+        return shards[blockSlot(id) % kShardCount];
+    }
+
+    // Vista sobre los bytes del bloque en `pos`; el llamador debe tener el lock del shard
+    static MemoryBlock blockAt(const BlockTable& table, size_t pos) {
+        return MemoryBlock(table.valueAddress(pos), table.sizes[pos], table.types[pos]);
+    }
+
+    const Chunk& chunkOf(const char* addr) const {
+        for (const auto& chunk : chunks) {
+            if (addr >= chunk.base && addr < chunk.base + chunk.size) return chunk;
+        }
+        throw std::runtime_error("Direccion fuera del arena");
+    }
+
+    size_t residentBytesLocked() const {
+        size_t resident = 0;
+        for (const auto& chunk : chunks) resident += chunk.arena->residentBytes();
+        return resident;
+    }
+
+    // Mapea un chunk nuevo con lugar para al menos un bloque de `size` bytes,
+    // sin pasar de maxMemory; requiere allocMutex
+    bool growLocked(size_t size) {
+        size_t needed = allocator->blockSpan(size);
+        size_t bytes = std::min(std::max(chunkBytes, needed), maxMemory - totalMemory);
+        if (bytes < needed) return false;
+
+        auto arena = std::make_unique<Arena>(bytes + kChunkGuardBytes, arenaOptions);
+        char* base = arena->data();
+        if (!allocator->addRegion({base, bytes})) {
+            // La política no admite regiones sueltas: no se vuelve a intentar
+            maxMemory = totalMemory;
+            return false;
+        }
+        chunks.push_back({std::move(arena), base, bytes});
+        totalMemory += bytes;
+        return true;
+    }
+
+    // Libera los chunks agregados que están enteros en el espacio libre del
+    // asignador (sin bloques, páginas de slab ni bloques en cachés)
+    void releaseEmptyChunksLocked() {
+        if (chunks.size() == 1) return;
+
+        std::vector<size_t> freeInChunk(chunks.size(), 0);
+        for (const auto& block : allocator->freeBlocks()) {
+            char* addr = static_cast<char*>(block.address);
+            for (size_t c = 1; c < chunks.size(); ++c) {
+                if (addr >= chunks[c].base && addr < chunks[c].base + chunks[c].size) {
+                    freeInChunk[c] += block.size;
+                    break;
                 }
+            }
+        }
+        for (size_t c = chunks.size() - 1; c >= 1; --c) {
+            if (freeInChunk[c] != chunks[c].size) continue;
+            allocator->removeRegion({chunks[c].base, chunks[c].size});
+            totalMemory -= chunks[c].size;
+            chunks.erase(chunks.begin() + c);
+        }
+    }
+
+    // Valida tamaño y alineación pedidos; devuelve la alineación efectiva
+    size_t checkAllocation(size_t size, BlockType type, size_t alignment) const {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > kMaxBlockAlignment) {
+            throw std::runtime_error("Alineación inválida: " + std::to_string(alignment));
+        }
+        alignment = std::max(alignment, blockTypeAlignment(type));
+        if (cacheLineAlignment) alignment = std::max(alignment, kCacheLineBytes);
+
+        // Verificar tamaño mínimo según el tipo
+        size_t minSize = blockTypeSize(type);
+        if (size < minSize) {
+            throw std::runtime_error(std::string("Tamaño muy pequeño para el tipo ") + blockTypeName(type));
+        }
+        if (size > UINT32_MAX) {
+            throw std::runtime_error("Tamaño de bloque demasiado grande");
+        }
+        return alignment;
+    }
+
+    // Reintenta cortar después de que no hubo hueco: vacía las cachés,
+    // compacta si corresponde y, si no alcanza, crece el arena. Devuelve
+    // nullptr si no hubo forma; requiere allocMutex y que todo bloque cortado
+    // ya esté registrado en su shard.
+    void* makeRoomAndCarveLocked(size_t size, BlockType type, size_t alignment, bool& inSlab) {
+        failureCount++;
+        // Los bloques guardados en cachés vuelven al asignador antes de compactar
+        drainThreadCaches();
+        void* addr = carve(size, type, alignment, inSlab);
+        if (addr) return addr;
+
+        if (compactOnAllocate) {
+            if (compactionStepBytes == 0) {
+                compactMemoryLocked();
+            } else {
+                // Sólo un paso acotado; los siguientes Create continúan el trabajo
+                compactionPending = compactStepLocked(compactionStepBytes);
+            }
+            addr = carve(size, type, alignment, inSlab);
+        }
+        // Si compactar no alcanzó, el arena crece con un chunk nuevo
+        if (!addr && growLocked(size + alignment - 1)) addr = carve(size, type, alignment, inSlab);
+        return addr;
+    }
+
+    // Obtiene espacio para un bloque: primero del slab de su tipo, si lo hay
+    void* carve(size_t size, BlockType type, size_t alignment, bool& inSlab) {
+        auto it = slabs.find(type);
+        if (it != slabs.end() && it->second->getSlotSize() == size && alignment <= slabSlotAlignment(size)) {
+            if (void* addr = it->second->allocate()) {
+                inSlab = true;
                 return addr;
             }
         }
-        return nullptr;
+        inSlab = false;
+        return allocator->allocateAligned(size, alignment);
     }
 
-    // Libera memoria
-    void freeMemory(int id) {
-        auto it = std::remove_if(memoryTable.begin(), memoryTable.end(),
-            [id](const MemoryMap& block) { return block.id == id; });
+    // Los slots de un slab quedan alineados a su tamaño dentro de páginas alineadas
+    static size_t slabSlotAlignment(size_t slotSize) {
+        return std::min(slotSize & (~slotSize + 1), SlabAllocator::kPageAlignment);
+    }
+
+    // Alineación con la que se precortan los bloques de un bin de caché: la
+    // mayor potencia de dos que divide al tamaño (hasta 16), o una línea de
+    // caché si está activada cacheLineAlignment
+    size_t cacheBinAlignment(size_t size) const {
+        if (cacheLineAlignment) return kCacheLineBytes;
+        return std::min(size & (~size + 1), alignof(std::max_align_t));
+    }
+
+    // Alineación con la que se corta un bloque. Los tamaños que pasan por las
+    // cachés usan la de su bin, aunque se corten fuera de la caché (abajo o
+    // en un lote): así al liberarse pueden volver a cualquier bin y la
+    // compactación conserva esa alineación
+    size_t carveAlignment(size_t size, BlockType type, size_t alignment) const {
+        return isCacheable(size, type, alignment) ? cacheBinAlignment(size) : alignment;
+    }
+
+    // Shards que tocan `ids`, como máscara de bits por índice
+    static uint32_t shardMask(const std::vector<int>& ids) {
+        uint32_t mask = 0;
+        for (int id : ids) mask |= 1u << (blockSlot(id) % kShardCount);
+        return mask;
+    }
 
-        if (it != memoryTable.end()) {
-            FreeBlock freedBlock = {it->block.address, it->size};
-            freeList.push_back(freedBlock);
-            memoryTable.erase(it, memoryTable.end());
-            mergeFreeBlocks();
+    // Toma los shards de `mask` una sola vez cada uno, en orden de índice
+    template <typename Lock>
+    std::vector<Lock> lockShards(uint32_t mask) const {
+        std::vector<Lock> locks;
+        for (size_t s = 0; s < kShardCount; ++s) {
+            if (mask & (1u << s)) locks.emplace_back(shards[s].mutex);
         }
+        return locks;
     }
 
-    // Fusiona bloques libres adyacentes
-    void mergeFreeBlocks() {
-        if (freeList.empty()) return;
+    // Registra un bloque recién cortado en blocksByAddress y en su shard
+    int registerBlock(int id, size_t size, char* addr, BlockType type, size_t alignment, bool inSlab,
+                      bool inlined = false) {
+        Shard& shard = shardOf(id);
+        std::lock_guard<std::mutex> addressLock(addressMutex);
+        std::unique_lock<std::shared_mutex> shardLock(shard.mutex);
+        insertBlockLocked(shard, {0, id, addr, size, type, alignment, inSlab, inlined});
+        return id;
+    }
 
-        std::sort(freeList.begin(), freeList.end(), [](const FreeBlock& a, const FreeBlock& b) {
-            return a.address < b.address;
-        });
+    // Registra los bloques de un lote con addressMutex y cada shard tomados
+    // una sola vez; deja cada ID en su resultado
+    void registerBlocks(const std::vector<CarvedBlock>& carved, std::vector<BatchResult<int>>& results) {
+        if (carved.empty()) return;
+        std::vector<int> ids;
+        for (const CarvedBlock& block : carved) ids.push_back(block.id);
+
+        std::lock_guard<std::mutex> addressLock(addressMutex);
+        auto locks = lockShards<std::unique_lock<std::shared_mutex>>(shardMask(ids));
+        for (const CarvedBlock& block : carved) {
+            insertBlockLocked(shardOf(block.id), block);
+            results[block.index].value = block.id;
+        }
+    }
 
-        for (size_t i = 0; i < freeList.size() - 1; ) {
-            FreeBlock& current = freeList[i];
-            FreeBlock& next = freeList[i + 1];
+    // Requiere addressMutex y el lock exclusivo del shard
+    void insertBlockLocked(Shard& shard, const CarvedBlock& block) {
+        int id = block.id;
+        size_t pos = shard.table.insert(id, block.address, block.size, block.type, block.inSlab, block.inlined,
+                                        block.alignment);
+        if (!block.inSlab && !block.inlined) blocksByAddress.emplace(block.address, id);
+        if (block.type != BlockType::STRING) publish(id, blockAt(shard.table, pos));
+    }
 
-            if (static_cast<char*>(current.address) + current.size == next.address) {
-                current.size += next.size;
-                freeList.erase(freeList.begin() + i + 1);
-            } else {
-                i++;
+    // Quita un bloque de blocksByAddress y de su shard; devuelve su dirección
+    char* detachBlock(int id) {
+        Shard& shard = shardOf(id);
+        std::lock_guard<std::mutex> addressLock(addressMutex);
+        std::unique_lock<std::shared_mutex> shardLock(shard.mutex);
+        if (!shard.table.contains(id)) return nullptr;
+        return eraseBlockLocked(shard, id, shard.table.find(id));
+    }
+
+    // Requiere addressMutex y el lock exclusivo del shard
+    char* eraseBlockLocked(Shard& shard, int id, size_t pos) {
+        char* addr = static_cast<char*>(shard.table.addresses[pos]);
+        if (shard.table.inArena(pos)) blocksByAddress.erase(addr);
+        if (shard.table.types[pos] != BlockType::STRING) unpublish(id);
+        shard.table.erase(pos);
+        blockIds.release(id);
+        return addr;
+    }
+
+    // Escribe la copia publicada de un bloque; requiere el lock exclusivo de su shard
+    void publish(int id, const MemoryBlock& block) {
+        PublishedBlock& entry = published.ensure(blockSlot(id));
+        uint64_t value = 0;
+        uint32_t size = static_cast<uint32_t>(std::min(block.size, sizeof(value)));
+        std::memcpy(&value, block.address, size);
+
+        uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+        entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        entry.id.store(id, std::memory_order_relaxed);
+        entry.type.store(block.type, std::memory_order_relaxed);
+        entry.size.store(size, std::memory_order_relaxed);
+        entry.value.store(value, std::memory_order_relaxed);
+        entry.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void unpublish(int id) {
+        PublishedBlock& entry = *published.find(blockSlot(id));
+        uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+        entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        entry.id.store(-1, std::memory_order_relaxed);
+        entry.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Lee un escalar de la copia publicada; false si hay que ir por el camino
+    // con lock (ID inexistente o viejo, tipo o tamaño que no corresponden),
+    // que es el que arma el error
+    template <typename T>
+    bool readPublished(int id, T& out) const {
+        if (id < 0) return false;
+        const PublishedBlock* entry = published.find(blockSlot(id));
+        if (!entry) return false;
+
+        for (;;) {
+            uint32_t sequence = entry->sequence.load(std::memory_order_acquire);
+            if (sequence & 1) {
+                std::this_thread::yield(); // Hay un Set en curso
+                continue;
+            }
+            int32_t currentId = entry->id.load(std::memory_order_relaxed);
+            BlockType type = entry->type.load(std::memory_order_relaxed);
+            uint32_t size = entry->size.load(std::memory_order_relaxed);
+            uint64_t value = entry->value.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry->sequence.load(std::memory_order_relaxed) != sequence) continue;
+
+            if (currentId != id || !isBlockType<T>(type) || sizeof(T) > size) return false;
+            std::memcpy(&out, &value, sizeof(T));
+            return true;
+        }
+    }
+
+    // Libera memoria de un bloque cuyo contador ya llegó a 0
+    void freeMemory(int id) {
+        // Tamaño, tipo, alineación e inSlab no cambian durante la vida del bloque
+        size_t size;
+        BlockType type;
+        size_t alignment;
+        bool inSlab;
+        bool inlined;
+        {
+            const Shard& shard = shardOf(id);
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            size_t pos = shard.table.find(id);
+            size = shard.table.sizes[pos];
+            type = shard.table.types[pos];
+            alignment = shard.table.alignment(pos);
+            inSlab = shard.table.inSlab(pos);
+            inlined = shard.table.isInline(pos);
+        }
+
+        if (inlined) {
+            // No hay nada que devolver al asignador
+            detachBlock(id);
+            return;
+        }
+
+        if (!inSlab && isCacheable(size, type, alignment)) {
+            // El hueco queda en la caché del hilo para el próximo Create de ese tamaño
+            ThreadCache& cache = localCache();
+            bool cached = false;
+            bool overflow = false;
+            {
+                std::lock_guard<std::mutex> cacheLock(cache.mutex);
+                // Los bins entregan sus huecos como alineados a cacheBinAlignment
+                // sin mirar la dirección: sólo entra uno que de verdad lo esté.
+                // Con la caché tomada la compactación completa no lo mueve.
+                uintptr_t address = reinterpret_cast<uintptr_t>(getBlockAddress(id));
+                if (address % cacheBinAlignment(size) == 0) {
+                    std::vector<char*>& bin = cache.bins[size];
+                    bin.push_back(detachBlock(id));
+                    overflow = bin.size() > 2 * threadCacheBlocks;
+                    cached = true;
+                }
+            }
+            if (overflow) trimCache(cache, size);
+            if (cached) return;
+        }
+
+        std::lock_guard<std::mutex> allocLock(allocMutex);
+        releaseBlock({detachBlock(id), size, type, inSlab});
+    }
+
+    // Libera varios bloques cuyo contador ya llegó a 0 con allocMutex,
+    // addressMutex y cada shard tomados una sola vez. No pasa por las cachés
+    // de hilos: todo vuelve al asignador general (o a su slab).
+    void freeMemoryBatch(const std::vector<int>& ids) {
+        std::lock_guard<std::mutex> allocLock(allocMutex);
+        std::vector<FreedBlock> detached;
+        {
+            std::lock_guard<std::mutex> addressLock(addressMutex);
+            auto locks = lockShards<std::unique_lock<std::shared_mutex>>(shardMask(ids));
+            for (int id : ids) {
+                Shard& shard = shardOf(id);
+                size_t pos = shard.table.find(id);
+                size_t size = shard.table.sizes[pos];
+                BlockType type = shard.table.types[pos];
+                bool inSlab = shard.table.inSlab(pos);
+                bool inlined = shard.table.isInline(pos);
+                char* addr = eraseBlockLocked(shard, id, pos);
+                if (!inlined) detached.push_back({addr, size, type, inSlab});
             }
         }
+        // Los shards ya se soltaron: el asignador no necesita más que allocMutex
+        for (const FreedBlock& block : detached) releaseBlock(block);
+    }
+
+    // Devuelve al asignador (o a su slab) un bloque ya quitado de las tablas; requiere allocMutex
+    void releaseBlock(const FreedBlock& block) {
+        if (block.inSlab) {
+            slabs.at(block.type)->release(block.address);
+        } else {
+            allocator->release(block.address, block.size);
+        }
+    }
+
+    bool isInlinable(size_t size, BlockType type) const {
+        return inlineScalars && type != BlockType::STRING && size <= BlockTable::kInlineBytes;
+    }
+
+    // Sólo pasan por las cachés los tamaños chicos que no atiende un slab
+    bool isCacheable(size_t size, BlockType type, size_t alignment) const {
+        if (threadCacheBlocks == 0 || size > kMaxCachedBlockSize) return false;
+        if (alignment > cacheBinAlignment(size)) return false;
+        auto it = slabs.find(type);
+        return it == slabs.end() || it->second->getSlotSize() != size;
+    }
+
+    // Caché del hilo actual para este manager; se crea en el primer uso. Los
+    // IDs de instancia no se reutilizan, así que una entrada encontrada es
+    // siempre de este manager vivo; las de managers ya destruidos se podan
+    // cuando el hilo suma otra.
+    ThreadCache& localCache() {
+        thread_local LocalCaches caches;
+        auto it = caches.entries.find(instanceId);
+        if (it != caches.entries.end()) return *it->second.cache;
+
+        for (auto stale = caches.entries.begin(); stale != caches.entries.end(); ) {
+            if (stale->second.owner.expired()) stale = caches.entries.erase(stale);
+            else ++stale;
+        }
+        std::lock_guard<std::mutex> lock(threadCachesMutex);
+        threadCaches.push_back(std::make_unique<ThreadCache>());
+        caches.entries[instanceId] = {threadCaches.back().get(), cacheOwner};
+        return *threadCaches.back();
     }
 
-    // Obtiene el tamaño mínimo para un tipo
-    size_t getMinSizeForType(const std::string& type) const {
-        if (type == "int") return sizeof(int);
-        if (type == "float") return sizeof(float);
-        if (type == "double") return sizeof(double);
-        if (type == "char") return sizeof(char);
-        if (type == "bool") return sizeof(bool);
-        if (type == "short") return sizeof(short);
-        if (type == "long") return sizeof(long);
-        if (type == "long long") return sizeof(long long);
-        if (type == "unsigned") return sizeof(unsigned);
-        if (type == "string") return 1; // Minimum string size is 1 byte
-        return 1; // Default minimum size
+    // Un hilo terminó: sus bloques vuelven al asignador y su caché sale del
+    // registro. Lo llama ~LocalCaches con el mutex de cacheOwner tomado.
+    void releaseThreadCache(ThreadCache* cache) {
+        std::lock_guard<std::mutex> allocLock(allocMutex);
+        std::lock_guard<std::mutex> lock(threadCachesMutex);
+        {
+            std::lock_guard<std::mutex> cacheLock(cache->mutex);
+            drainCache(*cache);
+        }
+        threadCaches.erase(std::remove_if(threadCaches.begin(), threadCaches.end(),
+                                          [cache](const std::unique_ptr<ThreadCache>& owned) {
+                                              return owned.get() == cache;
+                                          }),
+                           threadCaches.end());
+    }
+
+    // Corta un lote de bloques de `size` bytes para la caché; false si no hubo espacio
+    bool refillCache(ThreadCache& cache, size_t size) {
+        std::lock_guard<std::mutex> allocLock(allocMutex);
+        std::lock_guard<std::mutex> cacheLock(cache.mutex);
+        std::vector<char*>& bin = cache.bins[size];
+        for (size_t i = 0; i < threadCacheBlocks; ++i) {
+            char* addr = static_cast<char*>(allocator->allocateAligned(size, cacheBinAlignment(size)));
+            if (!addr) break;
+            bin.push_back(addr);
+        }
+        return !bin.empty();
+    }
+
+    // Devuelve al asignador la mitad sobrante de un bin de la caché
+    void trimCache(ThreadCache& cache, size_t size) {
+        std::lock_guard<std::mutex> allocLock(allocMutex);
+        std::lock_guard<std::mutex> cacheLock(cache.mutex);
+        std::vector<char*>& bin = cache.bins[size];
+        while (bin.size() > threadCacheBlocks) {
+            allocator->release(bin.back(), size);
+            bin.pop_back();
+        }
+    }
+
+    // Vacía todas las cachés de hilos; requiere allocMutex
+    void drainThreadCaches() {
+        std::lock_guard<std::mutex> lock(threadCachesMutex);
+        for (auto& cache : threadCaches) {
+            std::lock_guard<std::mutex> cacheLock(cache->mutex);
+            drainCache(*cache);
+        }
+    }
+
+    // Requiere allocMutex y el mutex de la caché
+    void drainCache(ThreadCache& cache) {
+        for (auto& [size, bin] : cache.bins) {
+            for (char* addr : bin) allocator->release(addr, size);
+            bin.clear();
+        }
+    }
+
+    size_t countCachedBlocks() {
+        std::lock_guard<std::mutex> lock(threadCachesMutex);
+        size_t count = 0;
+        for (auto& cache : threadCaches) {
+            std::lock_guard<std::mutex> cacheLock(cache->mutex);
+            for (const auto& [size, bin] : cache->bins) count += bin.size();
+        }
+        return count;
+    }
+
+    static std::unique_ptr<FreeSpaceAllocator> createAllocator(AllocatorPolicy policy) {
+        switch (policy) {
+            case AllocatorPolicy::SIZE_CLASS:
+                return std::make_unique<SizeClassAllocator>();
+            case AllocatorPolicy::TLSF:
+                return std::make_unique<TlsfAllocator>();
+            case AllocatorPolicy::BUDDY:
+                return std::make_unique<BuddyAllocator>();
+            case AllocatorPolicy::FIRST_FIT:
+            default:
+                return std::make_unique<FirstFitAllocator>();
+        }
     }
 };
\ No newline at end of file
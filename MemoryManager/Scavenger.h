@@ -0,0 +1,68 @@
+#ifndef SCAVENGER_H
+#define SCAVENGER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Configuración del hilo que devuelve páginas libres al sistema
+struct ScavengerOptions {
+    std::chrono::milliseconds interval{1000};
+    size_t minBytes = 64 * 1024; // Huecos más chicos no valen la llamada a madvise
+};
+
+// Hilo que llama periódicamente a MemoryManagerProgram::scavenge para bajar
+// el RSS después de ráfagas de bloques grandes (incluir después de
+// MemoryManagerProgram.cpp).
+class Scavenger {
+public:
+    using ReportCallback = std::function<void(size_t bytesReleased)>;
+
+    Scavenger(MemoryManagerProgram& manager, const ScavengerOptions& options,
+              ReportCallback onReport = nullptr)
+        : manager(manager), options(options), onReport(std::move(onReport)) {}
+
+    ~Scavenger() {
+        stop();
+    }
+
+    void start() {
+        if (worker.joinable()) return;
+        stopping = false;
+        worker = std::thread([this] { run(); });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            stopping = true;
+        }
+        wakeup.notify_all();
+        if (worker.joinable()) worker.join();
+    }
+
+private:
+    MemoryManagerProgram& manager;
+    ScavengerOptions options;
+    ReportCallback onReport;
+
+    std::thread worker;
+    std::mutex waitMutex;
+    std::condition_variable wakeup;
+    bool stopping = false;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(waitMutex);
+        while (!stopping) {
+            if (wakeup.wait_for(lock, options.interval, [this] { return stopping; })) break;
+            lock.unlock();
+            size_t released = manager.scavenge(options.minBytes);
+            if (released > 0 && onReport) onReport(released);
+            lock.lock();
+        }
+    }
+};
+
+#endif // SCAVENGER_H
@@ -0,0 +1,188 @@
+#ifndef SIZECLASSALLOCATOR_H
+#define SIZECLASSALLOCATOR_H
+
+#include "FreeSpaceAllocator.h"
+#include <array>
+
+// Listas libres segregadas por clases de tamaño potencia de dos (1 B .. 4 KB).
+// Cada clase guarda sus huecos en una pila, así que asignar y liberar los
+// tamaños comunes (char, int/float, string de 64 B) es O(1). Los huecos se
+// recortan por tandas del asignador de respaldo; los bloques más grandes que
+// la última clase van directo al respaldo con primer ajuste.
+class SizeClassAllocator : public FreeSpaceAllocator {
+public:
+    static constexpr size_t kClassCount = 13;
+    static constexpr size_t kMaxClassSize = size_t(1) << (kClassCount - 1);
+    static constexpr size_t kRunBytes = 4096;   // Máximo de bytes por recarga
+    static constexpr size_t kSlotsPerRefill = 64;
+    static constexpr size_t kRunAlignment = 64; // Las tandas empiezan en una línea de caché
+
+    struct BinStats {
+        size_t allocations = 0; // Asignaciones servidas por la clase
+        size_t inUse = 0;       // Huecos entregados y no devueltos
+        size_t carved = 0;      // Huecos que pertenecen a la clase (en uso + libres)
+    };
+
+    void* allocate(size_t size) override {
+        if (size > kMaxClassSize) return backing.allocate(size);
+
+        size_t cls = classIndex(size);
+        std::vector<void*>& bin = bins[cls];
+        if (bin.empty() && !refill(cls)) return nullptr;
+
+        void* addr = bin.back();
+        bin.pop_back();
+        stats[cls].allocations++;
+        stats[cls].inUse++;
+        return addr;
+    }
+
+    // Los huecos de una clase quedan alineados a su tamaño (hasta
+    // kRunAlignment); si se pide más, se corta un hueco suelto del respaldo
+    // que al liberarse entra a la clase como cualquier otro
+    void* allocateAligned(size_t size, size_t alignment) override {
+        if (size > kMaxClassSize) return backing.allocateAligned(size, alignment);
+
+        size_t cls = classIndex(size);
+        if (alignment <= classAlignment(cls)) return allocate(size);
+
+        void* addr = backing.allocateAligned(classSize(cls), alignment);
+        if (!addr) return nullptr;
+        stats[cls].allocations++;
+        stats[cls].inUse++;
+        stats[cls].carved++;
+        return addr;
+    }
+
+    size_t paddingBytes() const override {
+        return FreeSpaceAllocator::paddingBytes() + backing.paddingBytes();
+    }
+
+    void resetPadding() override {
+        FreeSpaceAllocator::resetPadding();
+        backing.resetPadding();
+    }
+
+    void release(void* address, size_t size) override {
+        forgetPadding(address);
+        if (size > kMaxClassSize) {
+            backing.release(address, size);
+            return;
+        }
+        size_t cls = classIndex(size);
+        // Un hueco cortado suelto con alineación extra deja de contar su prefijo
+        backing.forgetPadding(address);
+        stats[cls].inUse--;
+        // allocate entrega huecos de los bins sin mirar su dirección: sólo
+        // entran los que cumplen la alineación de la clase. Uno que la
+        // compactación dejó corrido vuelve al respaldo.
+        if (reinterpret_cast<uintptr_t>(address) % classAlignment(cls) != 0) {
+            stats[cls].carved--;
+            backing.release(address, classSize(cls));
+            return;
+        }
+        bins[cls].push_back(address);
+    }
+
+    size_t blockSpan(size_t size) const override {
+        return size > kMaxClassSize ? size : classSize(classIndex(size));
+    }
+
+    void reset(const std::vector<FreeBlock>& regions) override {
+        // Tras compactar los huecos libres de cada clase ya no existen
+        for (size_t cls = 0; cls < kClassCount; ++cls) {
+            bins[cls].clear();
+            stats[cls].carved = stats[cls].inUse;
+        }
+        backing.reset(regions);
+    }
+
+    std::vector<FreeBlock> freeBlocks() const override {
+        std::vector<FreeBlock> result = backing.freeBlocks();
+        for (size_t cls = 0; cls < kClassCount; ++cls) {
+            for (void* addr : bins[cls]) {
+                result.push_back({addr, classSize(cls)});
+            }
+        }
+        return result;
+    }
+
+    size_t totalFreeBytes() const override {
+        size_t total = backing.totalFreeBytes();
+        for (size_t cls = 0; cls < kClassCount; ++cls) {
+            total += bins[cls].size() * classSize(cls);
+        }
+        return total;
+    }
+
+    size_t largestFreeBlock() const override {
+        size_t largest = backing.largestFreeBlock();
+        for (size_t cls = kClassCount; cls-- > 0; ) {
+            if (!bins[cls].empty()) {
+                largest = std::max(largest, classSize(cls));
+                break;
+            }
+        }
+        return largest;
+    }
+
+    void writeStats(std::ostream& out) const override {
+        out << "Size Classes:\n";
+        for (size_t cls = 0; cls < kClassCount; ++cls) {
+            if (stats[cls].carved == 0 && stats[cls].allocations == 0) continue;
+            out << "  Class: " << classSize(cls) << " bytes"
+                << " | In use: " << stats[cls].inUse
+                << " | Free: " << bins[cls].size()
+                << " | Allocations: " << stats[cls].allocations << "\n";
+        }
+    }
+
+    const BinStats& binStats(size_t size) const {
+        return stats[classIndex(size)];
+    }
+
+    const char* name() const override { return "sizeclass"; }
+
+    static size_t classIndex(size_t size) {
+        size_t cls = 0;
+        while (classSize(cls) < size) cls++;
+        return cls;
+    }
+
+    static size_t classSize(size_t cls) {
+        return size_t(1) << cls;
+    }
+
+    // Alineación garantizada de todo hueco guardado en el bin de la clase
+    static size_t classAlignment(size_t cls) {
+        return std::min(classSize(cls), kRunAlignment);
+    }
+
+private:
+    FirstFitAllocator backing;
+    std::array<std::vector<void*>, kClassCount> bins;
+    std::array<BinStats, kClassCount> stats;
+
+    // Recorta una tanda de huecos para la clase; si no cabe, intenta uno solo
+    bool refill(size_t cls) {
+        size_t slot = classSize(cls);
+        size_t count = std::max<size_t>(1, std::min(kSlotsPerRefill, kRunBytes / slot));
+
+        size_t alignment = classAlignment(cls);
+        char* run = static_cast<char*>(backing.allocateAligned(count * slot, alignment));
+        if (!run) {
+            count = 1;
+            run = static_cast<char*>(backing.allocateAligned(slot, alignment));
+            if (!run) return false;
+        }
+
+        // Apilar en orden inverso para entregar primero las direcciones bajas
+        for (size_t i = count; i-- > 0; ) {
+            bins[cls].push_back(run + i * slot);
+        }
+        stats[cls].carved += count;
+        return true;
+    }
+};
+
+#endif // SIZECLASSALLOCATOR_H
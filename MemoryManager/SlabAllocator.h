@@ -0,0 +1,193 @@
+#ifndef SLABALLOCATOR_H
+#define SLABALLOCATOR_H
+
+#include "FreeSpaceAllocator.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+// Slabs para bloques escalares de tamaño fijo (int, float, char). Cada página
+// de kPageSize bytes se pide al asignador general y se divide en huecos del
+// mismo tamaño; un mapa de bits marca los ocupados. Los valores quedan juntos
+// en el arena y asignar o liberar es O(1). Cuando una página se vacía se
+// devuelve al asignador general (salvo una que se guarda para evitar rebotes).
+class SlabAllocator {
+public:
+    static constexpr size_t kPageSize = 4096;
+    static constexpr size_t kPageAlignment = 64; // Los slots quedan alineados a su tamaño
+    static constexpr size_t kEmptyPagesKept = 1;
+
+    struct Page {
+        char* base;
+        std::vector<uint64_t> used; // Bit = hueco ocupado
+        size_t usedCount = 0;
+        size_t firstFreeWord = 0;   // Ninguna palabra anterior tiene huecos libres
+        size_t index = 0;           // Posición en pages
+        size_t partialIndex = 0;    // Posición en partialPages si no está llena
+        bool partial = false;
+    };
+
+    SlabAllocator(FreeSpaceAllocator* general, size_t slotSize)
+        : general(general), slotSize(slotSize), slotsPerPage(kPageSize / slotSize) {}
+
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    ~SlabAllocator() = default;
+
+    // Devuelve un hueco libre o nullptr si el asignador general no tiene páginas
+    void* allocate() {
+        if (partialPages.empty() && !addPage()) return nullptr;
+
+        Page* page = partialPages.back();
+        if (page->usedCount == 0) emptyPages--;
+
+        size_t w = page->firstFreeWord;
+        while (page->used[w] == ~uint64_t(0)) w++;
+        unsigned bit = __builtin_ctzll(~page->used[w]);
+        page->used[w] |= uint64_t(1) << bit;
+        page->firstFreeWord = w;
+        page->usedCount++;
+        usedSlots++;
+
+        if (page->usedCount == slotsPerPage) removePartial(page);
+        return page->base + (w * 64 + bit) * slotSize;
+    }
+
+    void release(void* address) {
+        Page* page = pageOf(address);
+        if (!page) throw std::runtime_error("Direccion fuera de los slabs");
+
+        size_t slot = (static_cast<char*>(address) - page->base) / slotSize;
+        size_t w = slot / 64;
+        page->used[w] &= ~(uint64_t(1) << (slot % 64));
+        page->firstFreeWord = std::min(page->firstFreeWord, w);
+        if (page->usedCount == slotsPerPage) addPartial(page);
+        page->usedCount--;
+        usedSlots--;
+
+        if (page->usedCount == 0) {
+            if (emptyPages >= kEmptyPagesKept) {
+                releasePage(page);
+            } else {
+                emptyPages++;
+            }
+        }
+    }
+
+    // Página que contiene una dirección (O(1): a lo sumo dos páginas tocan cada tramo)
+    Page* pageOf(const void* address) const {
+        const char* addr = static_cast<const char*>(address);
+        auto it = buckets.find(reinterpret_cast<uintptr_t>(addr) / kPageSize);
+        if (it == buckets.end()) return nullptr;
+        for (Page* page : it->second) {
+            if (page && addr >= page->base && addr < page->base + kPageSize) return page;
+        }
+        return nullptr;
+    }
+
+    // Devuelve todas las páginas vacías al asignador general
+    void releaseEmptyPages() {
+        for (size_t i = pages.size(); i-- > 0; ) {
+            if (pages[i]->usedCount == 0) releasePage(pages[i].get());
+        }
+        emptyPages = 0;
+    }
+
+    // Tras mover páginas (compactación) hay que reconstruir el índice
+    void rebuildIndex() {
+        buckets.clear();
+        for (const auto& page : pages) registerPage(page.get());
+    }
+
+    const std::vector<std::unique_ptr<Page>>& getPages() const { return pages; }
+    size_t getSlotSize() const { return slotSize; }
+    size_t getUsedSlots() const { return usedSlots; }
+    size_t getCapacity() const { return pages.size() * slotsPerPage; }
+
+private:
+    FreeSpaceAllocator* general;
+    size_t slotSize;
+    size_t slotsPerPage;
+    size_t usedSlots = 0;
+    size_t emptyPages = 0;
+    std::vector<std::unique_ptr<Page>> pages;
+    std::vector<Page*> partialPages;
+    std::unordered_map<uintptr_t, std::array<Page*, 2>> buckets; // Tramo de kPageSize -> páginas
+
+    bool addPage() {
+        char* base = static_cast<char*>(general->allocateAligned(kPageSize, kPageAlignment));
+        if (!base) return false;
+
+        auto page = std::make_unique<Page>();
+        page->base = base;
+        page->used.assign((slotsPerPage + 63) / 64, 0);
+        // Los bits que sobran en la última palabra quedan marcados como ocupados
+        if (slotsPerPage % 64 != 0) {
+            page->used.back() = ~uint64_t(0) << (slotsPerPage % 64);
+        }
+        page->index = pages.size();
+        registerPage(page.get());
+        addPartial(page.get());
+        emptyPages++;
+        pages.push_back(std::move(page));
+        return true;
+    }
+
+    void releasePage(Page* page) {
+        if (page->partial) removePartial(page);
+        unregisterPage(page);
+        general->release(page->base, kPageSize);
+
+        size_t index = page->index;
+        if (index != pages.size() - 1) {
+            pages[index] = std::move(pages.back());
+            pages[index]->index = index;
+        }
+        pages.pop_back();
+    }
+
+    void addPartial(Page* page) {
+        page->partial = true;
+        page->partialIndex = partialPages.size();
+        partialPages.push_back(page);
+    }
+
+    void removePartial(Page* page) {
+        size_t index = page->partialIndex;
+        partialPages[index] = partialPages.back();
+        partialPages[index]->partialIndex = index;
+        partialPages.pop_back();
+        page->partial = false;
+    }
+
+    void registerPage(Page* page) {
+        uintptr_t first = reinterpret_cast<uintptr_t>(page->base) / kPageSize;
+        uintptr_t last = (reinterpret_cast<uintptr_t>(page->base) + kPageSize - 1) / kPageSize;
+        for (uintptr_t bucket = first; bucket <= last; ++bucket) {
+            auto& slots = buckets[bucket];
+            if (!slots[0]) slots[0] = page;
+            else slots[1] = page;
+        }
+    }
+
+    void unregisterPage(Page* page) {
+        uintptr_t first = reinterpret_cast<uintptr_t>(page->base) / kPageSize;
+        uintptr_t last = (reinterpret_cast<uintptr_t>(page->base) + kPageSize - 1) / kPageSize;
+        for (uintptr_t bucket = first; bucket <= last; ++bucket) {
+            auto it = buckets.find(bucket);
+            if (it == buckets.end()) continue;
+            auto& slots = it->second;
+            if (slots[0] == page) {
+                slots[0] = slots[1];
+                slots[1] = nullptr;
+            } else if (slots[1] == page) {
+                slots[1] = nullptr;
+            }
+            if (!slots[0]) buckets.erase(it);
+        }
+    }
+};
+
+#endif // SLABALLOCATOR_H
@@ -0,0 +1,251 @@
+#ifndef TLSFALLOCATOR_H
+#define TLSFALLOCATOR_H
+
+#include "FreeSpaceAllocator.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+// Asignador TLSF (two-level segregated fit). Los bloques libres se reparten en
+// listas indexadas por dos niveles: el primero es la potencia de dos del tamaño
+// y el segundo divide ese rango en kSlCount partes. Dos mapas de bits permiten
+// encontrar una lista adecuada con un par de instrucciones, así que asignar y
+// liberar cuestan O(1) aunque el arena esté casi lleno.
+//
+// El arena sólo guarda datos de usuario, por eso las "etiquetas de frontera"
+// viven fuera de él: byStart y byEnd ubican en O(1) al vecino libre que
+// empieza donde termina el bloque liberado y al que termina donde empieza.
+class TlsfAllocator : public FreeSpaceAllocator {
+public:
+    static constexpr unsigned kSlLog2 = 4;
+    static constexpr unsigned kSlCount = 1u << kSlLog2;
+    static constexpr unsigned kFlCount = 64 - kSlLog2 + 1;
+
+    TlsfAllocator() = default;
+    TlsfAllocator(const TlsfAllocator&) = delete;
+    TlsfAllocator& operator=(const TlsfAllocator&) = delete;
+
+    ~TlsfAllocator() override {
+        clear();
+        for (Node* node : spareNodes) delete node;
+    }
+
+    void* allocate(size_t size) override {
+        if (size == 0) size = 1;
+
+        unsigned fl, sl;
+        mappingSearch(size, fl, sl);
+        Node* node = findSuitable(fl, sl);
+        if (!node) return nullptr;
+
+        removeNode(node);
+        char* addr = node->address;
+        if (node->size > size) {
+            char* rest = addr + size;
+            size_t restSize = node->size - size;
+            node->address = rest;
+            node->size = restSize;
+            insertNode(node);
+        } else {
+            recycleNode(node);
+        }
+        return addr;
+    }
+
+    void release(void* address, size_t size) override {
+        forgetPadding(address);
+        if (size == 0) size = 1;
+        insertAndMerge(static_cast<char*>(address), size);
+    }
+
+    void reset(const std::vector<FreeBlock>& regions) override {
+        clear();
+        for (const auto& region : regions) {
+            if (region.size > 0) insertAndMerge(static_cast<char*>(region.address), region.size);
+        }
+    }
+
+    std::vector<FreeBlock> freeBlocks() const override {
+        std::vector<FreeBlock> result;
+        result.reserve(byStart.size());
+        for (const auto& [addr, node] : byStart) {
+            result.push_back({addr, node->size});
+        }
+        std::sort(result.begin(), result.end(), [](const FreeBlock& a, const FreeBlock& b) {
+            return a.address < b.address;
+        });
+        return result;
+    }
+
+    size_t totalFreeBytes() const override { return freeBytes; }
+
+    size_t largestFreeBlock() const override {
+        if (flBitmap == 0) return 0;
+        unsigned fl = 63 - __builtin_clzll(flBitmap);
+        unsigned sl = 63 - __builtin_clzll(slBitmap[fl]);
+        size_t largest = 0;
+        for (Node* node = heads[fl][sl]; node; node = node->nextFree) {
+            largest = std::max(largest, node->size);
+        }
+        return largest;
+    }
+
+    void writeStats(std::ostream& out) const override {
+        out << "TLSF Lists:\n";
+        for (unsigned fl = 0; fl < kFlCount; ++fl) {
+            if (!(flBitmap & (uint64_t(1) << fl))) continue;
+            for (unsigned sl = 0; sl < kSlCount; ++sl) {
+                if (!(slBitmap[fl] & (uint64_t(1) << sl))) continue;
+                size_t count = 0;
+                for (Node* node = heads[fl][sl]; node; node = node->nextFree) count++;
+                out << "  FL: " << fl << " | SL: " << sl
+                    << " | Min size: " << listMinSize(fl, sl) << " bytes"
+                    << " | Blocks: " << count << "\n";
+            }
+        }
+    }
+
+    const char* name() const override { return "tlsf"; }
+
+private:
+    struct Node {
+        char* address;
+        size_t size;
+        Node* prevFree;
+        Node* nextFree;
+    };
+
+    uint64_t flBitmap = 0;
+    std::array<uint64_t, kFlCount> slBitmap{};
+    std::array<std::array<Node*, kSlCount>, kFlCount> heads{};
+    std::unordered_map<char*, Node*> byStart; // Dirección inicial -> bloque libre
+    std::unordered_map<char*, Node*> byEnd;   // Dirección final -> bloque libre
+    std::vector<Node*> spareNodes;
+    size_t freeBytes = 0;
+
+    static unsigned log2Floor(size_t size) {
+        return 63 - __builtin_clzll(static_cast<unsigned long long>(size));
+    }
+
+    // Índices de la lista a la que pertenece un bloque de `size` bytes
+    static void mapping(size_t size, unsigned& fl, unsigned& sl) {
+        if (size < kSlCount) {
+            fl = 0;
+            sl = static_cast<unsigned>(size);
+        } else {
+            unsigned log2 = log2Floor(size);
+            fl = log2 - kSlLog2 + 1;
+            sl = static_cast<unsigned>(size >> (log2 - kSlLog2)) ^ kSlCount;
+        }
+    }
+
+    // Igual que mapping, pero redondea hacia arriba para que cualquier bloque
+    // de la lista resultante sirva para `size` sin tener que recorrerla
+    static void mappingSearch(size_t size, unsigned& fl, unsigned& sl) {
+        if (size >= kSlCount) {
+            size_t round = (size_t(1) << (log2Floor(size) - kSlLog2)) - 1;
+            if (size <= SIZE_MAX - round) size += round;
+        }
+        mapping(size, fl, sl);
+    }
+
+    static size_t listMinSize(unsigned fl, unsigned sl) {
+        if (fl == 0) return sl;
+        unsigned log2 = fl + kSlLog2 - 1;
+        return (size_t(1) << log2) + (size_t(sl) << (log2 - kSlLog2));
+    }
+
+    Node* findSuitable(unsigned& fl, unsigned& sl) const {
+        if (fl >= kFlCount) return nullptr;
+        uint64_t slMap = slBitmap[fl] & (~uint64_t(0) << sl);
+        if (!slMap) {
+            if (fl + 1 >= kFlCount) return nullptr;
+            uint64_t flMap = flBitmap & (~uint64_t(0) << (fl + 1));
+            if (!flMap) return nullptr;
+            fl = __builtin_ctzll(flMap);
+            slMap = slBitmap[fl];
+        }
+        sl = __builtin_ctzll(slMap);
+        return heads[fl][sl];
+    }
+
+    void insertNode(Node* node) {
+        unsigned fl, sl;
+        mapping(node->size, fl, sl);
+        node->prevFree = nullptr;
+        node->nextFree = heads[fl][sl];
+        if (node->nextFree) node->nextFree->prevFree = node;
+        heads[fl][sl] = node;
+        flBitmap |= uint64_t(1) << fl;
+        slBitmap[fl] |= uint64_t(1) << sl;
+
+        byStart[node->address] = node;
+        byEnd[node->address + node->size] = node;
+        freeBytes += node->size;
+    }
+
+    void removeNode(Node* node) {
+        unsigned fl, sl;
+        mapping(node->size, fl, sl);
+        if (node->prevFree) node->prevFree->nextFree = node->nextFree;
+        else heads[fl][sl] = node->nextFree;
+        if (node->nextFree) node->nextFree->prevFree = node->prevFree;
+        if (!heads[fl][sl]) {
+            slBitmap[fl] &= ~(uint64_t(1) << sl);
+            if (!slBitmap[fl]) flBitmap &= ~(uint64_t(1) << fl);
+        }
+
+        byStart.erase(node->address);
+        byEnd.erase(node->address + node->size);
+        freeBytes -= node->size;
+    }
+
+    Node* newNode(char* address, size_t size) {
+        Node* node;
+        if (spareNodes.empty()) {
+            node = new Node();
+        } else {
+            node = spareNodes.back();
+            spareNodes.pop_back();
+        }
+        node->address = address;
+        node->size = size;
+        return node;
+    }
+
+    void recycleNode(Node* node) {
+        spareNodes.push_back(node);
+    }
+
+    // Inserta un bloque libre fusionándolo con los vecinos libres adyacentes
+    void insertAndMerge(char* addr, size_t size) {
+        auto left = byEnd.find(addr);
+        if (left != byEnd.end()) {
+            Node* prev = left->second;
+            removeNode(prev);
+            addr = prev->address;
+            size += prev->size;
+            recycleNode(prev);
+        }
+        auto right = byStart.find(addr + size);
+        if (right != byStart.end()) {
+            Node* next = right->second;
+            removeNode(next);
+            size += next->size;
+            recycleNode(next);
+        }
+        insertNode(newNode(addr, size));
+    }
+
+    void clear() {
+        for (const auto& [addr, node] : byStart) delete node;
+        byStart.clear();
+        byEnd.clear();
+        heads = {};
+        slBitmap = {};
+        flBitmap = 0;
+        freeBytes = 0;
+    }
+};
+
+#endif // TLSFALLOCATOR_H
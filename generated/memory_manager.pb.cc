@@ -1,2596 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: memory_manager.proto
-// Protobuf C++ Version: 5.29.3
-
-#include "memory_manager.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace memorymanager {
-
-inline constexpr SetResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : error_message_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        success_{false},
-        bytes_written_{0u},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SetResponse::SetResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SetResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SetResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SetResponseDefaultTypeInternal() {}
-  union {
-    SetResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetResponseDefaultTypeInternal _SetResponse_default_instance_;
-
-inline constexpr SetRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : id_{0},
-        type_{static_cast< ::memorymanager::DataType >(0)},
-        value_{},
-        _cached_size_{0},
-        _oneof_case_{} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SetRequest::SetRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SetRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SetRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SetRequestDefaultTypeInternal() {}
-  union {
-    SetRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetRequestDefaultTypeInternal _SetRequest_default_instance_;
-
-inline constexpr RefCountResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : ref_count_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RefCountResponse::RefCountResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RefCountResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RefCountResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RefCountResponseDefaultTypeInternal() {}
-  union {
-    RefCountResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RefCountResponseDefaultTypeInternal _RefCountResponse_default_instance_;
-
-inline constexpr RefCountRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : id_{0},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RefCountRequest::RefCountRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RefCountRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RefCountRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RefCountRequestDefaultTypeInternal() {}
-  union {
-    RefCountRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RefCountRequestDefaultTypeInternal _RefCountRequest_default_instance_;
-
-inline constexpr GetResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : type_{static_cast< ::memorymanager::DataType >(0)},
-        value_{},
-        _cached_size_{0},
-        _oneof_case_{} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetResponse::GetResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetResponseDefaultTypeInternal() {}
-  union {
-    GetResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetResponseDefaultTypeInternal _GetResponse_default_instance_;
-
-inline constexpr GetRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : id_{0},
-        expected_type_{static_cast< ::memorymanager::DataType >(0)},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetRequest::GetRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetRequestDefaultTypeInternal() {}
-  union {
-    GetRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRequestDefaultTypeInternal _GetRequest_default_instance_;
-
-inline constexpr CreateResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : id_{0},
-        type_{static_cast< ::memorymanager::DataType >(0)},
-        actual_size_{0u},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreateResponse::CreateResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreateResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreateResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreateResponseDefaultTypeInternal() {}
-  union {
-    CreateResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateResponseDefaultTypeInternal _CreateResponse_default_instance_;
-
-inline constexpr CreateRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : type_{static_cast< ::memorymanager::DataType >(0)},
-        size_{0u},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreateRequest::CreateRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreateRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreateRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreateRequestDefaultTypeInternal() {}
-  union {
-    CreateRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateRequestDefaultTypeInternal _CreateRequest_default_instance_;
-}  // namespace memorymanager
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_memory_5fmanager_2eproto[1];
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_memory_5fmanager_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_memory_5fmanager_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateRequest, _impl_.type_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateRequest, _impl_.size_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateResponse, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateResponse, _impl_.type_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::CreateResponse, _impl_.actual_size_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetRequest, _impl_._oneof_case_[0]),
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetRequest, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetRequest, _impl_.type_),
-        ::_pbi::kInvalidFieldOffsetTag,
-        ::_pbi::kInvalidFieldOffsetTag,
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetRequest, _impl_.value_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetResponse, _impl_.success_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetResponse, _impl_.error_message_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::SetResponse, _impl_.bytes_written_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetRequest, _impl_.id_),
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetRequest, _impl_.expected_type_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetResponse, _impl_._oneof_case_[0]),
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetResponse, _impl_.type_),
-        ::_pbi::kInvalidFieldOffsetTag,
-        ::_pbi::kInvalidFieldOffsetTag,
-        PROTOBUF_FIELD_OFFSET(::memorymanager::GetResponse, _impl_.value_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::RefCountRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::RefCountRequest, _impl_.id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::memorymanager::RefCountResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::memorymanager::RefCountResponse, _impl_.ref_count_),
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::memorymanager::CreateRequest)},
-        {10, -1, -1, sizeof(::memorymanager::CreateResponse)},
-        {21, -1, -1, sizeof(::memorymanager::SetRequest)},
-        {34, -1, -1, sizeof(::memorymanager::SetResponse)},
-        {45, -1, -1, sizeof(::memorymanager::GetRequest)},
-        {55, -1, -1, sizeof(::memorymanager::GetResponse)},
-        {67, -1, -1, sizeof(::memorymanager::RefCountRequest)},
-        {76, -1, -1, sizeof(::memorymanager::RefCountResponse)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::memorymanager::_CreateRequest_default_instance_._instance,
-    &::memorymanager::_CreateResponse_default_instance_._instance,
-    &::memorymanager::_SetRequest_default_instance_._instance,
-    &::memorymanager::_SetResponse_default_instance_._instance,
-    &::memorymanager::_GetRequest_default_instance_._instance,
-    &::memorymanager::_GetResponse_default_instance_._instance,
-    &::memorymanager::_RefCountRequest_default_instance_._instance,
-    &::memorymanager::_RefCountResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_memory_5fmanager_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\024memory_manager.proto\022\rmemorymanager\"D\n"
-    "\rCreateRequest\022%\n\004type\030\001 \001(\0162\027.memoryman"
-    "ager.DataType\022\014\n\004size\030\002 \001(\r\"X\n\016CreateRes"
-    "ponse\022\n\n\002id\030\001 \001(\005\022%\n\004type\030\002 \001(\0162\027.memory"
-    "manager.DataType\022\023\n\013actual_size\030\003 \001(\r\"s\n"
-    "\nSetRequest\022\n\n\002id\030\001 \001(\005\022%\n\004type\030\002 \001(\0162\027."
-    "memorymanager.DataType\022\025\n\013binary_data\030\003 "
-    "\001(\014H\000\022\022\n\010str_data\030\004 \001(\tH\000B\007\n\005value\"L\n\013Se"
-    "tResponse\022\017\n\007success\030\001 \001(\010\022\025\n\rerror_mess"
-    "age\030\002 \001(\t\022\025\n\rbytes_written\030\003 \001(\r\"H\n\nGetR"
-    "equest\022\n\n\002id\030\001 \001(\005\022.\n\rexpected_type\030\002 \001("
-    "\0162\027.memorymanager.DataType\"h\n\013GetRespons"
-    "e\022%\n\004type\030\001 \001(\0162\027.memorymanager.DataType"
-    "\022\025\n\013binary_data\030\002 \001(\014H\000\022\022\n\010str_data\030\003 \001("
-    "\tH\000B\007\n\005value\"\035\n\017RefCountRequest\022\n\n\002id\030\001 "
-    "\001(\005\"%\n\020RefCountResponse\022\021\n\tref_count\030\001 \001"
-    "(\005*4\n\010DataType\022\007\n\003INT\020\000\022\t\n\005FLOAT\020\001\022\010\n\004CH"
-    "AR\020\002\022\n\n\006STRING\020\0032\374\002\n\rMemoryManager\022E\n\006Cr"
-    "eate\022\034.memorymanager.CreateRequest\032\035.mem"
-    "orymanager.CreateResponse\022<\n\003Set\022\031.memor"
-    "ymanager.SetRequest\032\032.memorymanager.SetR"
-    "esponse\022<\n\003Get\022\031.memorymanager.GetReques"
-    "t\032\032.memorymanager.GetResponse\022S\n\020Increas"
-    "eRefCount\022\036.memorymanager.RefCountReques"
-    "t\032\037.memorymanager.RefCountResponse\022S\n\020De"
-    "creaseRefCount\022\036.memorymanager.RefCountR"
-    "equest\032\037.memorymanager.RefCountResponseb"
-    "\006proto3"
-};
-static ::absl::once_flag descriptor_table_memory_5fmanager_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_memory_5fmanager_2eproto = {
-    false,
-    false,
-    1087,
-    descriptor_table_protodef_memory_5fmanager_2eproto,
-    "memory_manager.proto",
-    &descriptor_table_memory_5fmanager_2eproto_once,
-    nullptr,
-    0,
-    8,
-    schemas,
-    file_default_instances,
-    TableStruct_memory_5fmanager_2eproto::offsets,
-    file_level_enum_descriptors_memory_5fmanager_2eproto,
-    file_level_service_descriptors_memory_5fmanager_2eproto,
-};
-namespace memorymanager {
-const ::google::protobuf::EnumDescriptor* DataType_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_memory_5fmanager_2eproto);
-  return file_level_enum_descriptors_memory_5fmanager_2eproto[0];
-}
-PROTOBUF_CONSTINIT const uint32_t DataType_internal_data_[] = {
-    262144u, 0u, };
-bool DataType_IsValid(int value) {
-  return 0 <= value && value <= 3;
-}
-// ===================================================================
-
-class CreateRequest::_Internal {
- public:
-};
-
-CreateRequest::CreateRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.CreateRequest)
-}
-CreateRequest::CreateRequest(
-    ::google::protobuf::Arena* arena, const CreateRequest& from)
-    : CreateRequest(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE CreateRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void CreateRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, type_),
-           0,
-           offsetof(Impl_, size_) -
-               offsetof(Impl_, type_) +
-               sizeof(Impl_::size_));
-}
-CreateRequest::~CreateRequest() {
-  // @@protoc_insertion_point(destructor:memorymanager.CreateRequest)
-  SharedDtor(*this);
-}
-inline void CreateRequest::SharedDtor(MessageLite& self) {
-  CreateRequest& this_ = static_cast<CreateRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* CreateRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreateRequest(arena);
-}
-constexpr auto CreateRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(CreateRequest),
-                                            alignof(CreateRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreateRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreateRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreateRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreateRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreateRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreateRequest>(), &CreateRequest::ByteSizeLong,
-            &CreateRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_._cached_size_),
-        false,
-    },
-    &CreateRequest::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreateRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2> CreateRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::CreateRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // uint32 size = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CreateRequest, _impl_.size_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_.size_)}},
-    // .memorymanager.DataType type = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CreateRequest, _impl_.type_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_.type_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .memorymanager.DataType type = 1;
-    {PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_.type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // uint32 size = 2;
-    {PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_.size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void CreateRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.CreateRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.type_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.size_) -
-      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreateRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreateRequest& this_ = static_cast<const CreateRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreateRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreateRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.CreateRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // .memorymanager.DataType type = 1;
-          if (this_._internal_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                1, this_._internal_type(), target);
-          }
-
-          // uint32 size = 2;
-          if (this_._internal_size() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-                2, this_._internal_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.CreateRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreateRequest::ByteSizeLong(const MessageLite& base) {
-          const CreateRequest& this_ = static_cast<const CreateRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreateRequest::ByteSizeLong() const {
-          const CreateRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.CreateRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // .memorymanager.DataType type = 1;
-            if (this_._internal_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_type());
-            }
-            // uint32 size = 2;
-            if (this_._internal_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-                  this_._internal_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreateRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreateRequest*>(&to_msg);
-  auto& from = static_cast<const CreateRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.CreateRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_type() != 0) {
-    _this->_impl_.type_ = from._impl_.type_;
-  }
-  if (from._internal_size() != 0) {
-    _this->_impl_.size_ = from._impl_.size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreateRequest::CopyFrom(const CreateRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.CreateRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreateRequest::InternalSwap(CreateRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_.size_)
-      + sizeof(CreateRequest::_impl_.size_)
-      - PROTOBUF_FIELD_OFFSET(CreateRequest, _impl_.type_)>(
-          reinterpret_cast<char*>(&_impl_.type_),
-          reinterpret_cast<char*>(&other->_impl_.type_));
-}
-
-::google::protobuf::Metadata CreateRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CreateResponse::_Internal {
- public:
-};
-
-CreateResponse::CreateResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.CreateResponse)
-}
-CreateResponse::CreateResponse(
-    ::google::protobuf::Arena* arena, const CreateResponse& from)
-    : CreateResponse(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE CreateResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void CreateResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           0,
-           offsetof(Impl_, actual_size_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::actual_size_));
-}
-CreateResponse::~CreateResponse() {
-  // @@protoc_insertion_point(destructor:memorymanager.CreateResponse)
-  SharedDtor(*this);
-}
-inline void CreateResponse::SharedDtor(MessageLite& self) {
-  CreateResponse& this_ = static_cast<CreateResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* CreateResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreateResponse(arena);
-}
-constexpr auto CreateResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(CreateResponse),
-                                            alignof(CreateResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreateResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreateResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreateResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreateResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreateResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreateResponse>(), &CreateResponse::ByteSizeLong,
-            &CreateResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_._cached_size_),
-        false,
-    },
-    &CreateResponse::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreateResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2> CreateResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::CreateResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // int32 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CreateResponse, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.id_)}},
-    // .memorymanager.DataType type = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CreateResponse, _impl_.type_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.type_)}},
-    // uint32 actual_size = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(CreateResponse, _impl_.actual_size_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.actual_size_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 id = 1;
-    {PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // .memorymanager.DataType type = 2;
-    {PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // uint32 actual_size = 3;
-    {PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.actual_size_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void CreateResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.CreateResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.actual_size_) -
-      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.actual_size_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreateResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreateResponse& this_ = static_cast<const CreateResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreateResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreateResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.CreateResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // .memorymanager.DataType type = 2;
-          if (this_._internal_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                2, this_._internal_type(), target);
-          }
-
-          // uint32 actual_size = 3;
-          if (this_._internal_actual_size() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-                3, this_._internal_actual_size(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.CreateResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreateResponse::ByteSizeLong(const MessageLite& base) {
-          const CreateResponse& this_ = static_cast<const CreateResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreateResponse::ByteSizeLong() const {
-          const CreateResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.CreateResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_id());
-            }
-            // .memorymanager.DataType type = 2;
-            if (this_._internal_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_type());
-            }
-            // uint32 actual_size = 3;
-            if (this_._internal_actual_size() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-                  this_._internal_actual_size());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreateResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreateResponse*>(&to_msg);
-  auto& from = static_cast<const CreateResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.CreateResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  if (from._internal_type() != 0) {
-    _this->_impl_.type_ = from._impl_.type_;
-  }
-  if (from._internal_actual_size() != 0) {
-    _this->_impl_.actual_size_ = from._impl_.actual_size_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreateResponse::CopyFrom(const CreateResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.CreateResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreateResponse::InternalSwap(CreateResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.actual_size_)
-      + sizeof(CreateResponse::_impl_.actual_size_)
-      - PROTOBUF_FIELD_OFFSET(CreateResponse, _impl_.id_)>(
-          reinterpret_cast<char*>(&_impl_.id_),
-          reinterpret_cast<char*>(&other->_impl_.id_));
-}
-
-::google::protobuf::Metadata CreateResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SetRequest::_Internal {
- public:
-  static constexpr ::int32_t kOneofCaseOffset =
-      PROTOBUF_FIELD_OFFSET(::memorymanager::SetRequest, _impl_._oneof_case_);
-};
-
-SetRequest::SetRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.SetRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SetRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::memorymanager::SetRequest& from_msg)
-      : value_{},
-        _cached_size_{0},
-        _oneof_case_{from._oneof_case_[0]} {}
-
-SetRequest::SetRequest(
-    ::google::protobuf::Arena* arena,
-    const SetRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SetRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, id_),
-           offsetof(Impl_, type_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::type_));
-  switch (value_case()) {
-    case VALUE_NOT_SET:
-      break;
-      case kBinaryData:
-        new (&_impl_.value_.binary_data_) decltype(_impl_.value_.binary_data_){arena, from._impl_.value_.binary_data_};
-        break;
-      case kStrData:
-        new (&_impl_.value_.str_data_) decltype(_impl_.value_.str_data_){arena, from._impl_.value_.str_data_};
-        break;
-  }
-
-  // @@protoc_insertion_point(copy_constructor:memorymanager.SetRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SetRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : value_{},
-        _cached_size_{0},
-        _oneof_case_{} {}
-
-inline void SetRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           0,
-           offsetof(Impl_, type_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::type_));
-}
-SetRequest::~SetRequest() {
-  // @@protoc_insertion_point(destructor:memorymanager.SetRequest)
-  SharedDtor(*this);
-}
-inline void SetRequest::SharedDtor(MessageLite& self) {
-  SetRequest& this_ = static_cast<SetRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  if (this_.has_value()) {
-    this_.clear_value();
-  }
-  this_._impl_.~Impl_();
-}
-
-void SetRequest::clear_value() {
-// @@protoc_insertion_point(one_of_clear_start:memorymanager.SetRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  switch (value_case()) {
-    case kBinaryData: {
-      _impl_.value_.binary_data_.Destroy();
-      break;
-    }
-    case kStrData: {
-      _impl_.value_.str_data_.Destroy();
-      break;
-    }
-    case VALUE_NOT_SET: {
-      break;
-    }
-  }
-  _impl_._oneof_case_[0] = VALUE_NOT_SET;
-}
-
-
-inline void* SetRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SetRequest(arena);
-}
-constexpr auto SetRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(SetRequest),
-                                            alignof(SetRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SetRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SetRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SetRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SetRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SetRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SetRequest>(), &SetRequest::ByteSizeLong,
-            &SetRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SetRequest, _impl_._cached_size_),
-        false,
-    },
-    &SetRequest::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SetRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 4, 0, 41, 2> SetRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    4, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::SetRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .memorymanager.DataType type = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SetRequest, _impl_.type_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.type_)}},
-    // int32 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SetRequest, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 id = 1;
-    {PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // .memorymanager.DataType type = 2;
-    {PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // bytes binary_data = 3;
-    {PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.value_.binary_data_), _Internal::kOneofCaseOffset + 0, 0,
-    (0 | ::_fl::kFcOneof | ::_fl::kBytes | ::_fl::kRepAString)},
-    // string str_data = 4;
-    {PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.value_.str_data_), _Internal::kOneofCaseOffset + 0, 0,
-    (0 | ::_fl::kFcOneof | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\30\0\0\0\10\0\0\0"
-    "memorymanager.SetRequest"
-    "str_data"
-  }},
-};
-
-PROTOBUF_NOINLINE void SetRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.SetRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.type_) -
-      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.type_));
-  clear_value();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SetRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SetRequest& this_ = static_cast<const SetRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SetRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SetRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.SetRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // .memorymanager.DataType type = 2;
-          if (this_._internal_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                2, this_._internal_type(), target);
-          }
-
-          switch (this_.value_case()) {
-            case kBinaryData: {
-              const std::string& _s = this_._internal_binary_data();
-              target = stream->WriteBytesMaybeAliased(3, _s, target);
-              break;
-            }
-            case kStrData: {
-              const std::string& _s = this_._internal_str_data();
-              ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                  _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "memorymanager.SetRequest.str_data");
-              target = stream->WriteStringMaybeAliased(4, _s, target);
-              break;
-            }
-            default:
-              break;
-          }
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.SetRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SetRequest::ByteSizeLong(const MessageLite& base) {
-          const SetRequest& this_ = static_cast<const SetRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SetRequest::ByteSizeLong() const {
-          const SetRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.SetRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_id());
-            }
-            // .memorymanager.DataType type = 2;
-            if (this_._internal_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_type());
-            }
-          }
-          switch (this_.value_case()) {
-            // bytes binary_data = 3;
-            case kBinaryData: {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
-                                              this_._internal_binary_data());
-              break;
-            }
-            // string str_data = 4;
-            case kStrData: {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_str_data());
-              break;
-            }
-            case VALUE_NOT_SET: {
-              break;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SetRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SetRequest*>(&to_msg);
-  auto& from = static_cast<const SetRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.SetRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  if (from._internal_type() != 0) {
-    _this->_impl_.type_ = from._impl_.type_;
-  }
-  if (const uint32_t oneof_from_case = from._impl_._oneof_case_[0]) {
-    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
-    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
-    if (oneof_needs_init) {
-      if (oneof_to_case != 0) {
-        _this->clear_value();
-      }
-      _this->_impl_._oneof_case_[0] = oneof_from_case;
-    }
-
-    switch (oneof_from_case) {
-      case kBinaryData: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.binary_data_.InitDefault();
-        }
-        _this->_impl_.value_.binary_data_.Set(from._internal_binary_data(), arena);
-        break;
-      }
-      case kStrData: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.str_data_.InitDefault();
-        }
-        _this->_impl_.value_.str_data_.Set(from._internal_str_data(), arena);
-        break;
-      }
-      case VALUE_NOT_SET:
-        break;
-    }
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SetRequest::CopyFrom(const SetRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.SetRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SetRequest::InternalSwap(SetRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.type_)
-      + sizeof(SetRequest::_impl_.type_)
-      - PROTOBUF_FIELD_OFFSET(SetRequest, _impl_.id_)>(
-          reinterpret_cast<char*>(&_impl_.id_),
-          reinterpret_cast<char*>(&other->_impl_.id_));
-  swap(_impl_.value_, other->_impl_.value_);
-  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
-}
-
-::google::protobuf::Metadata SetRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SetResponse::_Internal {
- public:
-};
-
-SetResponse::SetResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.SetResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SetResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::memorymanager::SetResponse& from_msg)
-      : error_message_(arena, from.error_message_),
-        _cached_size_{0} {}
-
-SetResponse::SetResponse(
-    ::google::protobuf::Arena* arena,
-    const SetResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SetResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, success_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, success_),
-           offsetof(Impl_, bytes_written_) -
-               offsetof(Impl_, success_) +
-               sizeof(Impl_::bytes_written_));
-
-  // @@protoc_insertion_point(copy_constructor:memorymanager.SetResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SetResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : error_message_(arena),
-        _cached_size_{0} {}
-
-inline void SetResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, success_),
-           0,
-           offsetof(Impl_, bytes_written_) -
-               offsetof(Impl_, success_) +
-               sizeof(Impl_::bytes_written_));
-}
-SetResponse::~SetResponse() {
-  // @@protoc_insertion_point(destructor:memorymanager.SetResponse)
-  SharedDtor(*this);
-}
-inline void SetResponse::SharedDtor(MessageLite& self) {
-  SetResponse& this_ = static_cast<SetResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.error_message_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* SetResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SetResponse(arena);
-}
-constexpr auto SetResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SetResponse),
-                                            alignof(SetResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SetResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SetResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SetResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SetResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SetResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SetResponse>(), &SetResponse::ByteSizeLong,
-            &SetResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SetResponse, _impl_._cached_size_),
-        false,
-    },
-    &SetResponse::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SetResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 47, 2> SetResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::SetResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // bool success = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(SetResponse, _impl_.success_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.success_)}},
-    // string error_message = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.error_message_)}},
-    // uint32 bytes_written = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SetResponse, _impl_.bytes_written_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.bytes_written_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // bool success = 1;
-    {PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.success_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // string error_message = 2;
-    {PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.error_message_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // uint32 bytes_written = 3;
-    {PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.bytes_written_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\31\0\15\0\0\0\0\0"
-    "memorymanager.SetResponse"
-    "error_message"
-  }},
-};
-
-PROTOBUF_NOINLINE void SetResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.SetResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.error_message_.ClearToEmpty();
-  ::memset(&_impl_.success_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.bytes_written_) -
-      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.bytes_written_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SetResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SetResponse& this_ = static_cast<const SetResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SetResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SetResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.SetResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // bool success = 1;
-          if (this_._internal_success() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                1, this_._internal_success(), target);
-          }
-
-          // string error_message = 2;
-          if (!this_._internal_error_message().empty()) {
-            const std::string& _s = this_._internal_error_message();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "memorymanager.SetResponse.error_message");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // uint32 bytes_written = 3;
-          if (this_._internal_bytes_written() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
-                3, this_._internal_bytes_written(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.SetResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SetResponse::ByteSizeLong(const MessageLite& base) {
-          const SetResponse& this_ = static_cast<const SetResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SetResponse::ByteSizeLong() const {
-          const SetResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.SetResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string error_message = 2;
-            if (!this_._internal_error_message().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_error_message());
-            }
-            // bool success = 1;
-            if (this_._internal_success() != 0) {
-              total_size += 2;
-            }
-            // uint32 bytes_written = 3;
-            if (this_._internal_bytes_written() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
-                  this_._internal_bytes_written());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SetResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SetResponse*>(&to_msg);
-  auto& from = static_cast<const SetResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.SetResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_error_message().empty()) {
-    _this->_internal_set_error_message(from._internal_error_message());
-  }
-  if (from._internal_success() != 0) {
-    _this->_impl_.success_ = from._impl_.success_;
-  }
-  if (from._internal_bytes_written() != 0) {
-    _this->_impl_.bytes_written_ = from._impl_.bytes_written_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SetResponse::CopyFrom(const SetResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.SetResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SetResponse::InternalSwap(SetResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.error_message_, &other->_impl_.error_message_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.bytes_written_)
-      + sizeof(SetResponse::_impl_.bytes_written_)
-      - PROTOBUF_FIELD_OFFSET(SetResponse, _impl_.success_)>(
-          reinterpret_cast<char*>(&_impl_.success_),
-          reinterpret_cast<char*>(&other->_impl_.success_));
-}
-
-::google::protobuf::Metadata SetResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetRequest::_Internal {
- public:
-};
-
-GetRequest::GetRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.GetRequest)
-}
-GetRequest::GetRequest(
-    ::google::protobuf::Arena* arena, const GetRequest& from)
-    : GetRequest(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE GetRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GetRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, id_),
-           0,
-           offsetof(Impl_, expected_type_) -
-               offsetof(Impl_, id_) +
-               sizeof(Impl_::expected_type_));
-}
-GetRequest::~GetRequest() {
-  // @@protoc_insertion_point(destructor:memorymanager.GetRequest)
-  SharedDtor(*this);
-}
-inline void GetRequest::SharedDtor(MessageLite& self) {
-  GetRequest& this_ = static_cast<GetRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GetRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetRequest(arena);
-}
-constexpr auto GetRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetRequest),
-                                            alignof(GetRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetRequest>(), &GetRequest::ByteSizeLong,
-            &GetRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetRequest::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2> GetRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::GetRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .memorymanager.DataType expected_type = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetRequest, _impl_.expected_type_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.expected_type_)}},
-    // int32 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetRequest, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 id = 1;
-    {PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // .memorymanager.DataType expected_type = 2;
-    {PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.expected_type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.GetRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&_impl_.id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.expected_type_) -
-      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.expected_type_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetRequest& this_ = static_cast<const GetRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.GetRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          // .memorymanager.DataType expected_type = 2;
-          if (this_._internal_expected_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                2, this_._internal_expected_type(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.GetRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetRequest::ByteSizeLong(const MessageLite& base) {
-          const GetRequest& this_ = static_cast<const GetRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetRequest::ByteSizeLong() const {
-          const GetRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.GetRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // int32 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_id());
-            }
-            // .memorymanager.DataType expected_type = 2;
-            if (this_._internal_expected_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_expected_type());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetRequest*>(&to_msg);
-  auto& from = static_cast<const GetRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.GetRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  if (from._internal_expected_type() != 0) {
-    _this->_impl_.expected_type_ = from._impl_.expected_type_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetRequest::CopyFrom(const GetRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.GetRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetRequest::InternalSwap(GetRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.expected_type_)
-      + sizeof(GetRequest::_impl_.expected_type_)
-      - PROTOBUF_FIELD_OFFSET(GetRequest, _impl_.id_)>(
-          reinterpret_cast<char*>(&_impl_.id_),
-          reinterpret_cast<char*>(&other->_impl_.id_));
-}
-
-::google::protobuf::Metadata GetRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetResponse::_Internal {
- public:
-  static constexpr ::int32_t kOneofCaseOffset =
-      PROTOBUF_FIELD_OFFSET(::memorymanager::GetResponse, _impl_._oneof_case_);
-};
-
-GetResponse::GetResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.GetResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::memorymanager::GetResponse& from_msg)
-      : value_{},
-        _cached_size_{0},
-        _oneof_case_{from._oneof_case_[0]} {}
-
-GetResponse::GetResponse(
-    ::google::protobuf::Arena* arena,
-    const GetResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  _impl_.type_ = from._impl_.type_;
-  switch (value_case()) {
-    case VALUE_NOT_SET:
-      break;
-      case kBinaryData:
-        new (&_impl_.value_.binary_data_) decltype(_impl_.value_.binary_data_){arena, from._impl_.value_.binary_data_};
-        break;
-      case kStrData:
-        new (&_impl_.value_.str_data_) decltype(_impl_.value_.str_data_){arena, from._impl_.value_.str_data_};
-        break;
-  }
-
-  // @@protoc_insertion_point(copy_constructor:memorymanager.GetResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : value_{},
-        _cached_size_{0},
-        _oneof_case_{} {}
-
-inline void GetResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.type_ = {};
-}
-GetResponse::~GetResponse() {
-  // @@protoc_insertion_point(destructor:memorymanager.GetResponse)
-  SharedDtor(*this);
-}
-inline void GetResponse::SharedDtor(MessageLite& self) {
-  GetResponse& this_ = static_cast<GetResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  if (this_.has_value()) {
-    this_.clear_value();
-  }
-  this_._impl_.~Impl_();
-}
-
-void GetResponse::clear_value() {
-// @@protoc_insertion_point(one_of_clear_start:memorymanager.GetResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  switch (value_case()) {
-    case kBinaryData: {
-      _impl_.value_.binary_data_.Destroy();
-      break;
-    }
-    case kStrData: {
-      _impl_.value_.str_data_.Destroy();
-      break;
-    }
-    case VALUE_NOT_SET: {
-      break;
-    }
-  }
-  _impl_._oneof_case_[0] = VALUE_NOT_SET;
-}
-
-
-inline void* GetResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetResponse(arena);
-}
-constexpr auto GetResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetResponse),
-                                            alignof(GetResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetResponse>(), &GetResponse::ByteSizeLong,
-            &GetResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetResponse::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 3, 0, 42, 2> GetResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    3, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::GetResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .memorymanager.DataType type = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetResponse, _impl_.type_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GetResponse, _impl_.type_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .memorymanager.DataType type = 1;
-    {PROTOBUF_FIELD_OFFSET(GetResponse, _impl_.type_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // bytes binary_data = 2;
-    {PROTOBUF_FIELD_OFFSET(GetResponse, _impl_.value_.binary_data_), _Internal::kOneofCaseOffset + 0, 0,
-    (0 | ::_fl::kFcOneof | ::_fl::kBytes | ::_fl::kRepAString)},
-    // string str_data = 3;
-    {PROTOBUF_FIELD_OFFSET(GetResponse, _impl_.value_.str_data_), _Internal::kOneofCaseOffset + 0, 0,
-    (0 | ::_fl::kFcOneof | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\31\0\0\10\0\0\0\0"
-    "memorymanager.GetResponse"
-    "str_data"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.GetResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.type_ = 0;
-  clear_value();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetResponse& this_ = static_cast<const GetResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.GetResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // .memorymanager.DataType type = 1;
-          if (this_._internal_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                1, this_._internal_type(), target);
-          }
-
-          switch (this_.value_case()) {
-            case kBinaryData: {
-              const std::string& _s = this_._internal_binary_data();
-              target = stream->WriteBytesMaybeAliased(2, _s, target);
-              break;
-            }
-            case kStrData: {
-              const std::string& _s = this_._internal_str_data();
-              ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                  _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "memorymanager.GetResponse.str_data");
-              target = stream->WriteStringMaybeAliased(3, _s, target);
-              break;
-            }
-            default:
-              break;
-          }
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.GetResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetResponse::ByteSizeLong(const MessageLite& base) {
-          const GetResponse& this_ = static_cast<const GetResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetResponse::ByteSizeLong() const {
-          const GetResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.GetResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .memorymanager.DataType type = 1;
-            if (this_._internal_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_type());
-            }
-          }
-          switch (this_.value_case()) {
-            // bytes binary_data = 2;
-            case kBinaryData: {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::BytesSize(
-                                              this_._internal_binary_data());
-              break;
-            }
-            // string str_data = 3;
-            case kStrData: {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_str_data());
-              break;
-            }
-            case VALUE_NOT_SET: {
-              break;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetResponse*>(&to_msg);
-  auto& from = static_cast<const GetResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.GetResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_type() != 0) {
-    _this->_impl_.type_ = from._impl_.type_;
-  }
-  if (const uint32_t oneof_from_case = from._impl_._oneof_case_[0]) {
-    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
-    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
-    if (oneof_needs_init) {
-      if (oneof_to_case != 0) {
-        _this->clear_value();
-      }
-      _this->_impl_._oneof_case_[0] = oneof_from_case;
-    }
-
-    switch (oneof_from_case) {
-      case kBinaryData: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.binary_data_.InitDefault();
-        }
-        _this->_impl_.value_.binary_data_.Set(from._internal_binary_data(), arena);
-        break;
-      }
-      case kStrData: {
-        if (oneof_needs_init) {
-          _this->_impl_.value_.str_data_.InitDefault();
-        }
-        _this->_impl_.value_.str_data_.Set(from._internal_str_data(), arena);
-        break;
-      }
-      case VALUE_NOT_SET:
-        break;
-    }
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetResponse::CopyFrom(const GetResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.GetResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetResponse::InternalSwap(GetResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.type_, other->_impl_.type_);
-  swap(_impl_.value_, other->_impl_.value_);
-  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
-}
-
-::google::protobuf::Metadata GetResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RefCountRequest::_Internal {
- public:
-};
-
-RefCountRequest::RefCountRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.RefCountRequest)
-}
-RefCountRequest::RefCountRequest(
-    ::google::protobuf::Arena* arena, const RefCountRequest& from)
-    : RefCountRequest(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE RefCountRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void RefCountRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.id_ = {};
-}
-RefCountRequest::~RefCountRequest() {
-  // @@protoc_insertion_point(destructor:memorymanager.RefCountRequest)
-  SharedDtor(*this);
-}
-inline void RefCountRequest::SharedDtor(MessageLite& self) {
-  RefCountRequest& this_ = static_cast<RefCountRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* RefCountRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RefCountRequest(arena);
-}
-constexpr auto RefCountRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(RefCountRequest),
-                                            alignof(RefCountRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RefCountRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RefCountRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RefCountRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RefCountRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RefCountRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RefCountRequest>(), &RefCountRequest::ByteSizeLong,
-            &RefCountRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RefCountRequest, _impl_._cached_size_),
-        false,
-    },
-    &RefCountRequest::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RefCountRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> RefCountRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::RefCountRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RefCountRequest, _impl_.id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RefCountRequest, _impl_.id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 id = 1;
-    {PROTOBUF_FIELD_OFFSET(RefCountRequest, _impl_.id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void RefCountRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.RefCountRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.id_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RefCountRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RefCountRequest& this_ = static_cast<const RefCountRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RefCountRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RefCountRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.RefCountRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 id = 1;
-          if (this_._internal_id() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.RefCountRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RefCountRequest::ByteSizeLong(const MessageLite& base) {
-          const RefCountRequest& this_ = static_cast<const RefCountRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RefCountRequest::ByteSizeLong() const {
-          const RefCountRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.RefCountRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // int32 id = 1;
-            if (this_._internal_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RefCountRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RefCountRequest*>(&to_msg);
-  auto& from = static_cast<const RefCountRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.RefCountRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_id() != 0) {
-    _this->_impl_.id_ = from._impl_.id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RefCountRequest::CopyFrom(const RefCountRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.RefCountRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RefCountRequest::InternalSwap(RefCountRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.id_, other->_impl_.id_);
-}
-
-::google::protobuf::Metadata RefCountRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RefCountResponse::_Internal {
- public:
-};
-
-RefCountResponse::RefCountResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:memorymanager.RefCountResponse)
-}
-RefCountResponse::RefCountResponse(
-    ::google::protobuf::Arena* arena, const RefCountResponse& from)
-    : RefCountResponse(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE RefCountResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void RefCountResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.ref_count_ = {};
-}
-RefCountResponse::~RefCountResponse() {
-  // @@protoc_insertion_point(destructor:memorymanager.RefCountResponse)
-  SharedDtor(*this);
-}
-inline void RefCountResponse::SharedDtor(MessageLite& self) {
-  RefCountResponse& this_ = static_cast<RefCountResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* RefCountResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RefCountResponse(arena);
-}
-constexpr auto RefCountResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(RefCountResponse),
-                                            alignof(RefCountResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RefCountResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RefCountResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RefCountResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RefCountResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RefCountResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RefCountResponse>(), &RefCountResponse::ByteSizeLong,
-            &RefCountResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RefCountResponse, _impl_._cached_size_),
-        false,
-    },
-    &RefCountResponse::kDescriptorMethods,
-    &descriptor_table_memory_5fmanager_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RefCountResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> RefCountResponse::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::memorymanager::RefCountResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int32 ref_count = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RefCountResponse, _impl_.ref_count_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(RefCountResponse, _impl_.ref_count_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // int32 ref_count = 1;
-    {PROTOBUF_FIELD_OFFSET(RefCountResponse, _impl_.ref_count_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void RefCountResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:memorymanager.RefCountResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.ref_count_ = 0;
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RefCountResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RefCountResponse& this_ = static_cast<const RefCountResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RefCountResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RefCountResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:memorymanager.RefCountResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // int32 ref_count = 1;
-          if (this_._internal_ref_count() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<1>(
-                    stream, this_._internal_ref_count(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:memorymanager.RefCountResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RefCountResponse::ByteSizeLong(const MessageLite& base) {
-          const RefCountResponse& this_ = static_cast<const RefCountResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RefCountResponse::ByteSizeLong() const {
-          const RefCountResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:memorymanager.RefCountResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // int32 ref_count = 1;
-            if (this_._internal_ref_count() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_ref_count());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RefCountResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RefCountResponse*>(&to_msg);
-  auto& from = static_cast<const RefCountResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:memorymanager.RefCountResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_ref_count() != 0) {
-    _this->_impl_.ref_count_ = from._impl_.ref_count_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RefCountResponse::CopyFrom(const RefCountResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:memorymanager.RefCountResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RefCountResponse::InternalSwap(RefCountResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.ref_count_, other->_impl_.ref_count_);
-}
-
-::google::protobuf::Metadata RefCountResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace memorymanager
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_memory_5fmanager_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -6,15 +6,23 @@
 #include <string>
 #include <fstream>
 #include <mutex>
+#include <thread>
+#include <vector>
 #include <grpcpp/grpcpp.h>
 #include "generated/memory_manager.grpc.pb.h"
 #include "MemoryManagerProgram.cpp"
+#include "CompactionScheduler.h"
+#include "Scavenger.h"
 
 namespace fs = std::filesystem;
 
 using grpc::Server;
+using grpc::ServerAsyncReaderWriter;
+using grpc::ServerAsyncResponseWriter;
 using grpc::ServerBuilder;
+using grpc::ServerCompletionQueue;
 using grpc::ServerContext;
+using grpc::ServerReaderWriter;
 using grpc::Status;
 
 using memorymanager::MemoryManager;
@@ -26,6 +34,17 @@ using memorymanager::GetRequest;
 using memorymanager::GetResponse;
 using memorymanager::RefCountRequest;
 using memorymanager::RefCountResponse;
+using memorymanager::BatchCreateRequest;
+using memorymanager::BatchCreateResponse;
+using memorymanager::MultiGetRequest;
+using memorymanager::MultiGetResponse;
+using memorymanager::MultiSetRequest;
+using memorymanager::MultiSetResponse;
+using memorymanager::BatchRefDeltaRequest;
+using memorymanager::BatchRefDeltaResponse;
+using memorymanager::EntryStatus;
+using memorymanager::SessionRequest;
+using memorymanager::SessionResponse;
 using memorymanager::DataType;
 
 class MemoryManagerServiceImpl final : public MemoryManager::Service {
@@ -35,6 +54,11 @@ private:
     std::ofstream dumpFile;
     std::mutex dumpMutex;
     std::string dumpFileName;
+    CompactionScheduler* compactionScheduler = nullptr;
+
+    void recordRequest() {
+        if (compactionScheduler) compactionScheduler->recordRequest();
+    }
 
     // Función helper para obtener el timestamp actual
     std::string getCurrentTimestamp() {
@@ -68,6 +92,33 @@ private:
         }
     }
 
+    // Tipo y tamaño del bloque para un DataType del proto; un string sin tamaño usa 64 bytes
+    static BlockSpec toBlockSpec(DataType type, uint32_t size) {
+        switch (type) {
+            case DataType::INT:
+                return {sizeof(int32_t), BlockType::INT};
+            case DataType::FLOAT:
+                return {sizeof(float), BlockType::FLOAT};
+            case DataType::CHAR:
+                return {sizeof(char), BlockType::CHAR};
+            case DataType::STRING:
+                return {size > 0 ? size : 64, BlockType::STRING};
+            default:
+                throw std::runtime_error("Unsupported type");
+        }
+    }
+
+    static void setEntryStatus(EntryStatus* status, const std::string& error) {
+        status->set_success(error.empty());
+        status->set_error_message(error);
+    }
+
+    static std::string formatPercent(double ratio) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << ratio * 100.0 << "%";
+        return ss.str();
+    }
+
     void initDumpFile() {
         try {
             // Verificar que la carpeta existe y es accesible
@@ -108,6 +159,27 @@ public:
         initDumpFile();
     }
 
+    void setCompactionScheduler(CompactionScheduler* scheduler) {
+        compactionScheduler = scheduler;
+    }
+
+    void logCompaction(const CompactionReport& report) {
+        logOperation("COMPACTION",
+            std::string("Reason: ") + report.reason +
+            " | Duration: " + std::to_string(report.duration.count()) + " us" +
+            " | Bytes moved: " + std::to_string(report.bytesMoved) +
+            " | Fragmentation: " + formatPercent(report.fragmentationBefore) +
+            " -> " + formatPercent(report.fragmentationAfter));
+    }
+
+    void logScavenge(size_t bytesReleased) {
+        logOperation("SCAVENGE", "Bytes released: " + std::to_string(bytesReleased));
+    }
+
+    void logSession(size_t operations) {
+        logOperation("SESSION", "Operations: " + std::to_string(operations));
+    }
+
     ~MemoryManagerServiceImpl() {
         if (dumpFile.is_open()) {
             logOperation("SERVER STOP", "Cerrando servidor");
@@ -116,40 +188,22 @@ public:
     }
 
     Status Create(ServerContext* context, const CreateRequest* request, CreateResponse* response) override {
+        recordRequest();
         try {
-            std::string typeStr;
-            size_t size = 0;
+            BlockSpec spec = toBlockSpec(request->type(), request->size());
+            BlockType blockType = spec.type;
+            size_t size = spec.size;
 
-            switch(request->type()) {
-                case DataType::INT:
-                    typeStr = "int";
-                    size = sizeof(int32_t);
-                    break;
-                case DataType::FLOAT:
-                    typeStr = "float";
-                    size = sizeof(float);
-                    break;
-                case DataType::CHAR:
-                    typeStr = "char";
-                    size = sizeof(char);
-                    break;
-                case DataType::STRING:
-                    typeStr = "string";
-                    size = request->size() > 0 ? request->size() : 64;
-                    break;
-                default:
-                    throw std::runtime_error("Unsupported type");
-            }
-
-            int id = memManager.allocate(size, typeStr);
+            int id = memManager.allocate(size, blockType);
             response->set_id(id);
             response->set_type(request->type());
             response->set_actual_size(size);
 
             logOperation("NEW BLOCK",
                 "ID: " + std::to_string(id) +
-                " | Type: " + typeStr +
-                " | Size: " + std::to_string(size) + " bytes");
+                " | Type: " + blockTypeName(blockType) +
+                " | Size: " + std::to_string(size) + " bytes" +
+                " | Fragmentation: " + formatPercent(memManager.fragmentation()));
 
             return Status::OK;
         } catch (const std::exception& e) {
@@ -159,11 +213,11 @@ public:
     }
 
     Status Set(ServerContext* context, const SetRequest* request, SetResponse* response) override {
+        recordRequest();
         try {
-            std::string blockType = memManager.getBlockType(request->id());
+            BlockType blockType = memManager.getBlockType(request->id());
 
-            if ((request->type() == DataType::STRING && blockType != "string") ||
-                (request->type() != DataType::STRING && blockType == "string")) {
+            if ((request->type() == DataType::STRING) != (blockType == BlockType::STRING)) {
                 throw std::runtime_error("Type mismatch");
             }
 
@@ -240,53 +294,55 @@ public:
     }
 
     Status Get(ServerContext* context, const GetRequest* request, GetResponse* response) override {
+        recordRequest();
         try {
-            std::string blockType = memManager.getBlockType(request->id());
+            BlockType blockType = memManager.getBlockType(request->id());
 
-            if ((request->expected_type() == DataType::STRING && blockType != "string") ||
-                (request->expected_type() != DataType::STRING && blockType == "string")) {
+            if ((request->expected_type() == DataType::STRING) != (blockType == BlockType::STRING)) {
                 throw std::runtime_error("Type mismatch");
             }
 
             response->set_type(request->expected_type());
 
-            if (blockType == "string") {
-                std::string value = memManager.getValue<std::string>(request->id());
-                response->set_binary_data(value);
-                logOperation("GET VALUE",
-                    "ID: " + std::to_string(request->id()) +
-                    " | Value: \"" + value + "\"" +
-                    " | Type: string");
-            } else {
-                std::string binary_data;
-                binary_data.resize(blockType == "int" ? sizeof(int32_t) :
-                                 blockType == "float" ? sizeof(float) : sizeof(char));
-
-                if (blockType == "int") {
+            switch (blockType) {
+                case BlockType::STRING: {
+                    std::string value = memManager.getValue<std::string>(request->id());
+                    response->set_binary_data(value);
+                    logOperation("GET VALUE",
+                        "ID: " + std::to_string(request->id()) +
+                        " | Value: \"" + value + "\"" +
+                        " | Type: string");
+                    break;
+                }
+                case BlockType::INT: {
                     int32_t value = memManager.getValue<int32_t>(request->id());
-                    memcpy(binary_data.data(), &value, sizeof(int32_t));
+                    response->set_binary_data(std::string(reinterpret_cast<const char*>(&value), sizeof(int32_t)));
                     logOperation("GET VALUE",
                         "ID: " + std::to_string(request->id()) +
                         " | Value: " + std::to_string(value) +
                         " | Type: int");
+                    break;
                 }
-                else if (blockType == "float") {
+                case BlockType::FLOAT: {
                     float value = memManager.getValue<float>(request->id());
-                    memcpy(binary_data.data(), &value, sizeof(float));
+                    response->set_binary_data(std::string(reinterpret_cast<const char*>(&value), sizeof(float)));
                     logOperation("GET VALUE",
                         "ID: " + std::to_string(request->id()) +
                         " | Value: " + std::to_string(value) +
                         " | Type: float");
+                    break;
                 }
-                else if (blockType == "char") {
+                case BlockType::CHAR: {
                     char value = memManager.getValue<char>(request->id());
-                    binary_data[0] = value;
+                    response->set_binary_data(std::string(reinterpret_cast<const char*>(&value), sizeof(char)));
                     logOperation("GET VALUE",
                         "ID: " + std::to_string(request->id()) +
                         " | Value: '" + std::string(1, value) + "'" +
                         " | Type: char");
+                    break;
                 }
-                response->set_binary_data(binary_data);
+                default:
+                    throw std::runtime_error("Unsupported type");
             }
 
             return Status::OK;
@@ -297,6 +353,7 @@ public:
     }
 
     Status IncreaseRefCount(ServerContext* context, const RefCountRequest* request, RefCountResponse* response) override {
+        recordRequest();
         try {
             int id = request->id();
             int newCount = memManager.increaseRefCount(id);
@@ -313,6 +370,7 @@ public:
     }
 
     Status DecreaseRefCount(ServerContext* context, const RefCountRequest* request, RefCountResponse* response) override {
+        recordRequest();
         try {
             int id = request->id();
             int newCount = memManager.decreaseRefCount(id);
@@ -321,34 +379,490 @@ public:
                 "ID: " + std::to_string(id) +
                 " | New count: " + std::to_string(newCount) +
                 " (Decreased)");
+            if (newCount == 0) {
+                logOperation("FREE BLOCK",
+                    "ID: " + std::to_string(id) +
+                    " | Fragmentation: " + formatPercent(memManager.fragmentation()));
+            }
             return Status::OK;
         } catch (const std::exception& e) {
             logOperation("ERROR", std::string("Decrease ref count failed: ") + e.what());
             return Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
         }
     }
+
+    // Los lotes responden OK aunque fallen entradas: cada una trae su propio
+    // estado, en el mismo orden que la petición
+
+    Status BatchCreate(ServerContext* context, const BatchCreateRequest* request, BatchCreateResponse* response) override {
+        recordRequest();
+        std::vector<std::string> errors(request->entries_size());
+        std::vector<BlockSpec> specs;
+        std::vector<int> positions; // Entrada de la petición de cada spec
+        for (int i = 0; i < request->entries_size(); i++) {
+            try {
+                specs.push_back(toBlockSpec(request->entries(i).type(), request->entries(i).size()));
+                positions.push_back(i);
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        }
+
+        std::vector<int> ids(request->entries_size(), -1);
+        std::vector<size_t> sizes(request->entries_size(), 0);
+        auto results = memManager.allocateBatch(specs);
+        for (size_t j = 0; j < results.size(); j++) {
+            ids[positions[j]] = results[j].value;
+            errors[positions[j]] = results[j].error;
+            if (results[j].ok()) sizes[positions[j]] = specs[j].size;
+        }
+
+        size_t created = 0;
+        for (int i = 0; i < request->entries_size(); i++) {
+            CreateResponse* result = response->add_results();
+            result->set_id(ids[i]);
+            result->set_type(request->entries(i).type());
+            result->set_actual_size(sizes[i]);
+            if (errors[i].empty()) created++;
+            setEntryStatus(response->add_statuses(), errors[i]);
+        }
+
+        logOperation("BATCH CREATE",
+            "Entries: " + std::to_string(request->entries_size()) +
+            " | Created: " + std::to_string(created) +
+            " | Fragmentation: " + formatPercent(memManager.fragmentation()));
+        return Status::OK;
+    }
+
+    Status MultiGet(ServerContext* context, const MultiGetRequest* request, MultiGetResponse* response) override {
+        recordRequest();
+        std::vector<int> ids;
+        for (const auto& entry : request->entries()) ids.push_back(entry.id());
+
+        auto values = memManager.getValues(ids);
+        size_t found = 0;
+        for (int i = 0; i < request->entries_size(); i++) {
+            const GetRequest& entry = request->entries(i);
+            GetResponse* result = response->add_results();
+            result->set_type(entry.expected_type());
+            std::string error = values[i].error;
+            if (values[i].ok() &&
+                (entry.expected_type() == DataType::STRING) != (values[i].value.type == BlockType::STRING)) {
+                error = "Type mismatch";
+            }
+            if (error.empty()) {
+                result->set_binary_data(values[i].value.bytes);
+                found++;
+            }
+            setEntryStatus(response->add_statuses(), error);
+        }
+
+        logOperation("MULTI GET",
+            "Entries: " + std::to_string(request->entries_size()) +
+            " | Read: " + std::to_string(found));
+        return Status::OK;
+    }
+
+    Status MultiSet(ServerContext* context, const MultiSetRequest* request, MultiSetResponse* response) override {
+        recordRequest();
+        std::vector<std::string> errors(request->entries_size());
+        std::vector<BlockWrite> writes;
+        std::vector<int> positions; // Entrada de la petición de cada escritura
+        for (int i = 0; i < request->entries_size(); i++) {
+            const SetRequest& entry = request->entries(i);
+            try {
+                BlockType type = toBlockSpec(entry.type(), 0).type;
+                if (entry.value_case() == SetRequest::kBinaryData) {
+                    if (type == BlockType::STRING) throw std::runtime_error("Invalid binary type");
+                    writes.push_back({entry.id(), type, entry.binary_data()});
+                } else if (entry.value_case() == SetRequest::kStrData) {
+                    if (type != BlockType::STRING) throw std::runtime_error("Expected string type");
+                    writes.push_back({entry.id(), type, entry.str_data()});
+                } else {
+                    throw std::runtime_error("No data provided");
+                }
+                positions.push_back(i);
+            } catch (const std::exception& e) {
+                errors[i] = e.what();
+            }
+        }
+
+        std::vector<size_t> written(request->entries_size(), 0);
+        auto results = memManager.setValues(writes);
+        for (size_t j = 0; j < results.size(); j++) {
+            written[positions[j]] = results[j].value;
+            errors[positions[j]] = results[j].error;
+        }
+
+        size_t succeeded = 0;
+        for (int i = 0; i < request->entries_size(); i++) {
+            SetResponse* result = response->add_results();
+            result->set_success(errors[i].empty());
+            result->set_error_message(errors[i]);
+            result->set_bytes_written(written[i]);
+            if (errors[i].empty()) succeeded++;
+        }
+
+        logOperation("MULTI SET",
+            "Entries: " + std::to_string(request->entries_size()) +
+            " | Written: " + std::to_string(succeeded));
+        return Status::OK;
+    }
+
+    Status BatchRefDelta(ServerContext* context, const BatchRefDeltaRequest* request, BatchRefDeltaResponse* response) override {
+        recordRequest();
+        std::vector<RefDelta> deltas;
+        for (const auto& entry : request->entries()) deltas.push_back({entry.id(), entry.delta()});
+
+        auto counts = memManager.applyRefDeltas(deltas);
+        size_t freed = 0;
+        for (const auto& count : counts) {
+            response->add_results()->set_ref_count(count.value);
+            setEntryStatus(response->add_statuses(), count.error);
+            if (count.ok() && count.value == 0) freed++;
+        }
+
+        logOperation("BATCH REF COUNT",
+            "Entries: " + std::to_string(request->entries_size()) +
+            " | Freed: " + std::to_string(freed) +
+            " | Fragmentation: " + formatPercent(memManager.fragmentation()));
+        return Status::OK;
+    }
+
+    // Sesión: el cliente encadena operaciones sin esperar cada respuesta.
+    // Se atienden en el orden en que llegan y cada respuesta lleva el tag de
+    // su operación; un error sólo afecta a esa respuesta, no a la sesión.
+
+    Status Session(ServerContext* context, ServerReaderWriter<SessionResponse, SessionRequest>* stream) override {
+        SessionRequest request;
+        size_t operations = 0;
+        while (stream->Read(&request)) {
+            SessionResponse response;
+            handleSessionRequest(context, request, &response);
+            operations++;
+            if (!stream->Write(response)) break;
+        }
+        logSession(operations);
+        return Status::OK;
+    }
+
+    // Ejecuta una operación de sesión con el handler unario correspondiente;
+    // lo comparten el servicio síncrono y el motor asíncrono
+    void handleSessionRequest(ServerContext* context, const SessionRequest& request, SessionResponse* response) {
+        Status status;
+        switch (request.op_case()) {
+            case SessionRequest::kCreate:
+                status = Create(context, &request.create(), response->mutable_create());
+                break;
+            case SessionRequest::kSet:
+                status = Set(context, &request.set(), response->mutable_set());
+                break;
+            case SessionRequest::kGet:
+                status = Get(context, &request.get(), response->mutable_get());
+                break;
+            case SessionRequest::kIncreaseRefCount:
+                status = IncreaseRefCount(context, &request.increase_ref_count(), response->mutable_ref_count());
+                break;
+            case SessionRequest::kDecreaseRefCount:
+                status = DecreaseRefCount(context, &request.decrease_ref_count(), response->mutable_ref_count());
+                break;
+            default:
+                status = Status(grpc::StatusCode::INVALID_ARGUMENT, "Missing session operation");
+                break;
+        }
+        // Como en las RPC unarias, una operación fallida no lleva resultado
+        response->set_tag(request.tag());
+        response->set_success(status.ok());
+        if (!status.ok()) {
+            response->clear_result();
+            response->set_error_message(status.error_message());
+        }
+    }
+};
+
+// Motor asíncrono: en vez de un hilo por RPC en curso, un número fijo de
+// hilos atiende colas de completación. Cada cola tiene llamadas pedidas de
+// antemano por método; al llegar una se pide la siguiente, se ejecuta el
+// mismo handler del servicio síncrono y se responde. Las RPCs en espera no
+// ocupan hilos, así que el número de clientes no está atado a los pollers.
+class AsyncServerEngine {
+public:
+    static constexpr size_t kPendingCallsPerMethod = 16; // Llamadas pedidas por método y por cola
+
+    AsyncServerEngine(MemoryManagerServiceImpl& handler, size_t pollerCount)
+        : handler(handler), pollerCount(pollerCount > 0 ? pollerCount : 1) {}
+
+    ~AsyncServerEngine() {
+        stop();
+    }
+
+    // Antes de BuildAndStart: registra el servicio y crea una cola por poller
+    void registerWith(ServerBuilder& builder) {
+        builder.RegisterService(&service);
+        for (size_t i = 0; i < pollerCount; i++) {
+            queues.push_back(builder.AddCompletionQueue());
+        }
+    }
+
+    // Después de BuildAndStart: pide las primeras llamadas y arranca los hilos
+    void start() {
+        for (auto& queue : queues) {
+            for (size_t i = 0; i < kPendingCallsPerMethod; i++) {
+                new UnaryCall<CreateRequest, CreateResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestCreate, &MemoryManagerServiceImpl::Create);
+                new UnaryCall<SetRequest, SetResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestSet, &MemoryManagerServiceImpl::Set);
+                new UnaryCall<GetRequest, GetResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestGet, &MemoryManagerServiceImpl::Get);
+                new UnaryCall<RefCountRequest, RefCountResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestIncreaseRefCount, &MemoryManagerServiceImpl::IncreaseRefCount);
+                new UnaryCall<RefCountRequest, RefCountResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestDecreaseRefCount, &MemoryManagerServiceImpl::DecreaseRefCount);
+                new UnaryCall<BatchCreateRequest, BatchCreateResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestBatchCreate, &MemoryManagerServiceImpl::BatchCreate);
+                new UnaryCall<MultiGetRequest, MultiGetResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestMultiGet, &MemoryManagerServiceImpl::MultiGet);
+                new UnaryCall<MultiSetRequest, MultiSetResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestMultiSet, &MemoryManagerServiceImpl::MultiSet);
+                new UnaryCall<BatchRefDeltaRequest, BatchRefDeltaResponse>(
+                    service, handler, queue.get(),
+                    &MemoryManager::AsyncService::RequestBatchRefDelta, &MemoryManagerServiceImpl::BatchRefDelta);
+                new SessionCall(service, handler, queue.get());
+            }
+        }
+        for (auto& queue : queues) {
+            pollers.emplace_back([this, cq = queue.get()] { poll(cq); });
+        }
+    }
+
+    // Llamar después de Server::Shutdown: cierra las colas y las drena
+    void stop() {
+        for (auto& queue : queues) queue->Shutdown();
+        for (auto& poller : pollers) {
+            if (poller.joinable()) poller.join();
+        }
+        pollers.clear();
+        queues.clear();
+    }
+
+    size_t getPollerCount() const {
+        return pollerCount;
+    }
+
+private:
+    // Estado de una RPC en curso; el tag de la cola es el propio objeto
+    class AsyncCall {
+    public:
+        virtual ~AsyncCall() = default;
+        virtual void proceed(bool ok) = 0;
+    };
+
+    template <typename Request, typename Response>
+    class UnaryCall final : public AsyncCall {
+    public:
+        using RequestMethod = void (MemoryManager::AsyncService::*)(
+            ServerContext*, Request*, ServerAsyncResponseWriter<Response>*,
+            grpc::CompletionQueue*, ServerCompletionQueue*, void*);
+        using Handler = Status (MemoryManagerServiceImpl::*)(ServerContext*, const Request*, Response*);
+
+        UnaryCall(MemoryManager::AsyncService& service, MemoryManagerServiceImpl& handler,
+                  ServerCompletionQueue* cq, RequestMethod requestMethod, Handler handle)
+            : service(service), handler(handler), cq(cq), requestMethod(requestMethod),
+              handle(handle), responder(&context) {
+            (service.*requestMethod)(&context, &request, &responder, cq, cq, this);
+        }
+
+        void proceed(bool ok) override {
+            // Una llamada pedida que vuelve con !ok es la cola cerrándose
+            if (finishing || !ok) {
+                delete this;
+                return;
+            }
+
+            // Reponer la llamada pedida antes de atender esta
+            new UnaryCall(service, handler, cq, requestMethod, handle);
+
+            Status status = (handler.*handle)(&context, &request, &response);
+            finishing = true;
+            responder.Finish(response, status, this);
+        }
+
+    private:
+        MemoryManager::AsyncService& service;
+        MemoryManagerServiceImpl& handler;
+        ServerCompletionQueue* cq;
+        RequestMethod requestMethod;
+        Handler handle;
+
+        ServerContext context;
+        Request request;
+        Response response;
+        ServerAsyncResponseWriter<Response> responder;
+        bool finishing = false;
+    };
+
+    // Sesión bidireccional: alterna una lectura y una escritura, así que las
+    // operaciones se ejecutan y responden en orden. Mientras la sesión espera
+    // al cliente no ocupa ningún poller.
+    class SessionCall final : public AsyncCall {
+    public:
+        SessionCall(MemoryManager::AsyncService& service, MemoryManagerServiceImpl& handler,
+                    ServerCompletionQueue* cq)
+            : service(service), handler(handler), cq(cq), stream(&context) {
+            service.RequestSession(&context, &stream, cq, cq, this);
+        }
+
+        void proceed(bool ok) override {
+            switch (state) {
+                case State::Connecting:
+                    if (!ok) {
+                        delete this;
+                        return;
+                    }
+                    new SessionCall(service, handler, cq);
+                    read();
+                    break;
+                case State::Reading:
+                    // !ok: el cliente cerró su lado, no quedan operaciones
+                    if (!ok) {
+                        finish();
+                        break;
+                    }
+                    response.Clear();
+                    handler.handleSessionRequest(&context, request, &response);
+                    operations++;
+                    state = State::Writing;
+                    stream.Write(response, this);
+                    break;
+                case State::Writing:
+                    if (!ok) {
+                        finish();
+                        break;
+                    }
+                    read();
+                    break;
+                case State::Finishing:
+                    delete this;
+                    break;
+            }
+        }
+
+    private:
+        enum class State { Connecting, Reading, Writing, Finishing };
+
+        void read() {
+            state = State::Reading;
+            stream.Read(&request, this);
+        }
+
+        void finish() {
+            handler.logSession(operations);
+            state = State::Finishing;
+            stream.Finish(Status::OK, this);
+        }
+
+        MemoryManager::AsyncService& service;
+        MemoryManagerServiceImpl& handler;
+        ServerCompletionQueue* cq;
+
+        ServerContext context;
+        SessionRequest request;
+        SessionResponse response;
+        ServerAsyncReaderWriter<SessionResponse, SessionRequest> stream;
+        State state = State::Connecting;
+        size_t operations = 0;
+    };
+
+    MemoryManagerServiceImpl& handler;
+    size_t pollerCount;
+    MemoryManager::AsyncService service;
+    std::vector<std::unique_ptr<ServerCompletionQueue>> queues;
+    std::vector<std::thread> pollers;
+
+    static void poll(ServerCompletionQueue* cq) {
+        void* tag;
+        bool ok;
+        while (cq->Next(&tag, &ok)) {
+            static_cast<AsyncCall*>(tag)->proceed(ok);
+        }
+    }
 };
 
-void RunServer(int port, size_t memSizeMB, const std::string& dumpFolder) {
+void RunServer(int port, size_t memSizeMB, const std::string& dumpFolder, const MemoryManagerOptions& options,
+               bool backgroundCompaction, const CompactionSchedulerOptions& schedulerOptions,
+               bool scavenging, const ScavengerOptions& scavengerOptions,
+               bool asyncServer, size_t serverPollers) {
     std::string server_address = "0.0.0.0:" + std::to_string(port);
-    MemoryManagerProgram memManager(memSizeMB);
+    MemoryManagerProgram memManager(memSizeMB, options);
+    memManager.setDumpFolder(dumpFolder);
     MemoryManagerServiceImpl service(memManager, dumpFolder);
 
+    std::unique_ptr<CompactionScheduler> scheduler;
+    if (backgroundCompaction) {
+        scheduler = std::make_unique<CompactionScheduler>(memManager, schedulerOptions,
+            [&service](const CompactionReport& report) { service.logCompaction(report); });
+        service.setCompactionScheduler(scheduler.get());
+        scheduler->start();
+    }
+
+    std::unique_ptr<Scavenger> scavenger;
+    if (scavenging) {
+        scavenger = std::make_unique<Scavenger>(memManager, scavengerOptions,
+            [&service](size_t bytesReleased) { service.logScavenge(bytesReleased); });
+        scavenger->start();
+    }
+
     ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-    builder.RegisterService(&service);
+
+    // El servicio síncrono queda como respaldo; en modo async sólo aporta los handlers
+    std::unique_ptr<AsyncServerEngine> asyncEngine;
+    if (asyncServer) {
+        asyncEngine = std::make_unique<AsyncServerEngine>(service, serverPollers);
+        asyncEngine->registerWith(builder);
+    } else {
+        builder.RegisterService(&service);
+    }
 
     std::unique_ptr<Server> server(builder.BuildAndStart());
+    if (asyncEngine) asyncEngine->start();
 
     std::cout << "SERVIDOR EN LINEA - ESCUCHANDO EN " << server_address << std::endl;
-    std::cout << "CONFIG - Memory: " << memSizeMB << " MB | Dump folder: " << dumpFolder << std::endl;
+    std::cout << "CONFIG - Memory: " << memSizeMB << " MB"
+              << (options.maxSizeMB > memSizeMB ? " (max " + std::to_string(options.maxSizeMB) + " MB)" : "")
+              << " | Dump folder: " << dumpFolder
+              << " | Server: " << (asyncEngine ? "async (" + std::to_string(asyncEngine->getPollerCount()) + " pollers)" : std::string("sync"))
+              << " | Allocator: " << memManager.getAllocator().name()
+              << " | Arena: " << memManager.getArena().describe()
+              << " | Slabs: " << (options.scalarSlabs ? "on" : "off")
+              << " | Inline scalars: " << (options.inlineScalars ? "on" : "off")
+              << " | Cache-line alignment: " << (options.cacheLineAlignment ? "on" : "off")
+              << " | Compaction step: " << (options.compactionStepBytes ? std::to_string(options.compactionStepBytes) + " bytes" : "full")
+              << " | Compaction threads: " << (options.compactionThreads ? std::to_string(options.compactionThreads) : "auto")
+              << " | Thread cache: " << (options.threadCacheBlocks ? std::to_string(options.threadCacheBlocks) + " blocks" : "off")
+              << " | Background compaction: " << (backgroundCompaction ? "on" : "off")
+              << " | Scavenger: " << (scavenging ? std::to_string(scavengerOptions.interval.count()) + " ms" : "off")
+              << (options.lazyPageRelease ? " (MADV_FREE)" : "") << std::endl;
 
     server->Wait();
+    if (asyncEngine) asyncEngine->stop();
 }
 
 void mostrarUso() {
-    std::cerr << "Uso: ./mem-mgr –port LISTEN_PORT –memsize SIZE_MB –dumpFolder DUMP_FOLDER\n"
-              << "Ejemplo: ./mem-mgr –port 50051 –memsize 10 –dumpFolder ./dumps\n";
+    std::cerr << "Uso: ./mem-mgr –port LISTEN_PORT –memsize SIZE_MB –dumpFolder DUMP_FOLDER [–allocator firstfit|sizeclass|tlsf|buddy] [–slabs] [–inlineScalars] [–alignCacheLine] [–compactStep BYTES]\n"
+              << "       [–async] [–serverMode sync|async] [–pollers N]\n"
+              << "       [–backgroundCompaction] [–compactFragThreshold RATIO] [–compactFailRate RATIO] [–compactInterval MS] [–compactThreads N] [–threadCache N]\n"
+              << "       [–arena malloc|mmap] [–hugePages none|thp|explicit] [–prefault]\n"
+              << "       [–maxMemsize SIZE_MB] [–chunkSize SIZE_MB] [–scavenge MS] [–scavengeMin BYTES] [–lazyFree]\n"
+              << "Ejemplo: ./mem-mgr –port 50051 –memsize 10 –dumpFolder ./dumps –allocator tlsf\n";
     exit(EXIT_FAILURE);
 }
 
@@ -356,6 +870,13 @@ int main(int argc, char** argv) {
     int port = 50051;
     size_t memSizeMB = 10;
     std::string dumpFolder = "./dumps";
+    MemoryManagerOptions options;
+    bool backgroundCompaction = false;
+    CompactionSchedulerOptions schedulerOptions;
+    bool scavenging = false;
+    ScavengerOptions scavengerOptions;
+    bool asyncServer = false;
+    size_t serverPollers = std::max(1u, std::thread::hardware_concurrency());
 
     // Parsear argumentos
     for (int i = 1; i < argc; ++i) {
@@ -376,10 +897,121 @@ int main(int argc, char** argv) {
                 }
             } else mostrarUso();
         }
+        else if (arg == "-allocator" || arg == "--allocator") {
+            if (i + 1 < argc) {
+                try {
+                    options.policy = parseAllocatorPolicy(argv[++i]);
+                } catch (const std::exception& e) {
+                    std::cerr << e.what() << std::endl;
+                    mostrarUso();
+                }
+            } else mostrarUso();
+        }
+        else if (arg == "-slabs" || arg == "--slabs") {
+            options.scalarSlabs = true;
+        }
+        else if (arg == "-compactStep" || arg == "--compactStep") {
+            if (i + 1 < argc) options.compactionStepBytes = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-compactThreads" || arg == "--compactThreads") {
+            if (i + 1 < argc) options.compactionThreads = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-threadCache" || arg == "--threadCache") {
+            if (i + 1 < argc) options.threadCacheBlocks = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-arena" || arg == "--arena") {
+            if (i + 1 < argc) {
+                try {
+                    options.arena.backing = parseArenaBacking(argv[++i]);
+                } catch (const std::exception& e) {
+                    std::cerr << e.what() << std::endl;
+                    mostrarUso();
+                }
+            } else mostrarUso();
+        }
+        else if (arg == "-hugePages" || arg == "--hugePages") {
+            if (i + 1 < argc) {
+                try {
+                    options.arena.hugePages = parseHugePages(argv[++i]);
+                } catch (const std::exception& e) {
+                    std::cerr << e.what() << std::endl;
+                    mostrarUso();
+                }
+            } else mostrarUso();
+        }
+        else if (arg == "-prefault" || arg == "--prefault") {
+            options.arena.prefault = true;
+        }
+        else if (arg == "-maxMemsize" || arg == "--maxMemsize") {
+            if (i + 1 < argc) options.maxSizeMB = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-chunkSize" || arg == "--chunkSize") {
+            if (i + 1 < argc) options.chunkSizeMB = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-scavenge" || arg == "--scavenge") {
+            if (i + 1 < argc) {
+                scavenging = true;
+                scavengerOptions.interval = std::chrono::milliseconds(std::stoul(argv[++i]));
+            } else mostrarUso();
+        }
+        else if (arg == "-scavengeMin" || arg == "--scavengeMin") {
+            if (i + 1 < argc) scavengerOptions.minBytes = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-lazyFree" || arg == "--lazyFree") {
+            options.lazyPageRelease = true;
+        }
+        else if (arg == "-inlineScalars" || arg == "--inlineScalars") {
+            options.inlineScalars = true;
+        }
+        else if (arg == "-alignCacheLine" || arg == "--alignCacheLine") {
+            options.cacheLineAlignment = true;
+        }
+        else if (arg == "-backgroundCompaction" || arg == "--backgroundCompaction") {
+            backgroundCompaction = true;
+            options.compactOnAllocate = false;
+        }
+        else if (arg == "-compactFragThreshold" || arg == "--compactFragThreshold") {
+            if (i + 1 < argc) schedulerOptions.fragmentationThreshold = std::stod(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-compactFailRate" || arg == "--compactFailRate") {
+            if (i + 1 < argc) schedulerOptions.failureRateThreshold = std::stod(argv[++i]);
+            else mostrarUso();
+        }
+        else if (arg == "-compactInterval" || arg == "--compactInterval") {
+            if (i + 1 < argc) schedulerOptions.interval = std::chrono::milliseconds(std::stoul(argv[++i]));
+            else mostrarUso();
+        }
+        else if (arg == "-async" || arg == "--async") {
+            asyncServer = true;
+        }
+        else if (arg == "-serverMode" || arg == "--serverMode") {
+            if (i + 1 < argc) {
+                std::string mode = argv[++i];
+                if (mode == "async") asyncServer = true;
+                else if (mode == "sync") asyncServer = false;
+                else mostrarUso();
+            } else mostrarUso();
+        }
+        else if (arg == "-pollers" || arg == "--pollers") {
+            if (i + 1 < argc) serverPollers = std::stoul(argv[++i]);
+            else mostrarUso();
+        }
         else mostrarUso();
     }
 
+    if (options.policy == AllocatorPolicy::BUDDY && options.maxSizeMB > memSizeMB) {
+        std::cerr << "Warning: buddy allocator cannot grow, ignoring --maxMemsize" << std::endl;
+    }
+
     std::cout << "Iniciando Servidor...\n";
-    RunServer(port, memSizeMB, dumpFolder);
+    RunServer(port, memSizeMB, dumpFolder, options, backgroundCompaction, schedulerOptions,
+              scavenging, scavengerOptions, asyncServer, serverPollers);
     return 0;
 }
@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 #include "MemoryManagerProgram.cpp"
+#include "CompactionScheduler.h"
+#include "Scavenger.h"
 #include <string>
 #include <limits>
+#include <atomic>
+#include <thread>
+#include <set>
 
 class MemoryManagerTest : public ::testing::Test {
 protected:
@@ -179,6 +184,1082 @@ TEST_F(MemoryManagerTest, ErrorHandlingTest) {
     std::cout << "[PASS] Prueba de manejo de errores completada con éxito\n";
 }
 
+// Prueba de búsqueda por ID tras liberar y compactar
+TEST_F(MemoryManagerTest, IdIndexAfterFreeAndCompactTest) {
+    std::cout << "\n[TEST] Probando índice de IDs tras liberar y compactar\n";
+
+    std::vector<int> ids;
+    for (int i = 0; i < 1000; ++i) {
+        int id = manager->allocate(sizeof(int), "int");
+        ASSERT_NE(id, -1) << "Fallo al asignar bloque " << i;
+        manager->setValue<int>(id, i);
+        ids.push_back(id);
+    }
+
+    std::cout << "Liberando bloques pares...\n";
+    for (int i = 0; i < 1000; i += 2) {
+        ASSERT_EQ(manager->decreaseRefCount(ids[i]), 0);
+    }
+
+    std::cout << "Compactando memoria...\n";
+    manager->compactMemory();
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            EXPECT_THROW(manager->getValue<int>(ids[i]), std::runtime_error);
+        } else {
+            ASSERT_EQ(manager->getValue<int>(ids[i]), i) << "Valor incorrecto para ID " << ids[i];
+            ASSERT_EQ(manager->getBlockType(ids[i]), BlockType::INT);
+        }
+    }
+
+    std::cout << "[PASS] Prueba de índice de IDs completada con éxito\n";
+}
+
+// Prueba de fusión de bloques libres con sus vecinos
+TEST_F(MemoryManagerTest, FreeBlockCoalescingTest) {
+    std::cout << "\n[TEST] Probando fusión de bloques libres\n";
+
+    int a = manager->allocate(16, "string");
+    int b = manager->allocate(16, "string");
+    int c = manager->allocate(16, "string");
+    ASSERT_EQ(manager->getAllocator().freeBlocks().size(), 1u);
+
+    std::cout << "Liberando bloque central...\n";
+    manager->decreaseRefCount(b);
+    ASSERT_EQ(manager->getAllocator().freeBlocks().size(), 2u);
+
+    std::cout << "Liberando vecino izquierdo...\n";
+    manager->decreaseRefCount(a);
+    auto blocks = manager->getAllocator().freeBlocks();
+    ASSERT_EQ(blocks.size(), 2u);
+    ASSERT_EQ(blocks[0].size, 32u) << "El vecino izquierdo debería fusionarse con el central";
+
+    std::cout << "Liberando vecino derecho...\n";
+    manager->decreaseRefCount(c);
+    blocks = manager->getAllocator().freeBlocks();
+    ASSERT_EQ(blocks.size(), 1u) << "Toda la memoria debería quedar en un solo bloque libre";
+    ASSERT_EQ(blocks[0].size, 1'000'000u);
+
+    std::cout << "[PASS] Prueba de fusión completada con éxito\n";
+}
+
+// Prueba de la política de clases de tamaño
+TEST(MemoryManagerPolicyTest, SizeClassPolicyTest) {
+    std::cout << "\n[TEST] Probando política de clases de tamaño\n";
+
+    MemoryManagerProgram sizeClassManager(1, AllocatorPolicy::SIZE_CLASS);
+
+    int charId = sizeClassManager.allocate(sizeof(char), "char");
+    int intId = sizeClassManager.allocate(sizeof(int), "int");
+    int strId = sizeClassManager.allocate(64, "string");
+    ASSERT_NE(charId, -1);
+    ASSERT_NE(intId, -1);
+    ASSERT_NE(strId, -1);
+
+    sizeClassManager.setValue<char>(charId, 'x');
+    sizeClassManager.setValue<int>(intId, 7);
+    sizeClassManager.setValue<std::string>(strId, "clases");
+
+    const auto& allocator = static_cast<const SizeClassAllocator&>(sizeClassManager.getAllocator());
+    ASSERT_EQ(allocator.binStats(sizeof(int)).inUse, 1u);
+    ASSERT_EQ(allocator.blockSpan(5), 8u) << "5 bytes deberían redondearse a la clase de 8";
+
+    std::cout << "Liberando y reasignando un int...\n";
+    void* oldAddress = sizeClassManager.getBlockAddress(intId);
+    ASSERT_EQ(sizeClassManager.decreaseRefCount(intId), 0);
+    ASSERT_EQ(allocator.binStats(sizeof(int)).inUse, 0u);
+    int reusedId = sizeClassManager.allocate(sizeof(int), "int");
+    ASSERT_EQ(sizeClassManager.getBlockAddress(reusedId), oldAddress) << "La clase debería reutilizar el hueco liberado";
+
+    std::cout << "Compactando memoria...\n";
+    sizeClassManager.compactMemory();
+    ASSERT_EQ(sizeClassManager.getValue<char>(charId), 'x');
+    ASSERT_EQ(sizeClassManager.getValue<std::string>(strId), "clases");
+    ASSERT_EQ(allocator.binStats(sizeof(int)).inUse, 1u);
+
+    std::cout << "[PASS] Prueba de clases de tamaño completada con éxito\n";
+}
+
+// Prueba de la política TLSF
+TEST(MemoryManagerPolicyTest, TlsfPolicyTest) {
+    std::cout << "\n[TEST] Probando política TLSF\n";
+
+    MemoryManagerProgram tlsfManager(1, AllocatorPolicy::TLSF);
+    ASSERT_STREQ(tlsfManager.getAllocator().name(), "tlsf");
+
+    std::vector<int> ids;
+    for (int i = 0; i < 200; ++i) {
+        size_t size = (i % 3 == 0) ? 64 : (i % 3 == 1 ? sizeof(int) : 1000);
+        int id = tlsfManager.allocate(size, size == sizeof(int) ? "int" : "string");
+        ASSERT_NE(id, -1);
+        ids.push_back(id);
+    }
+    tlsfManager.setValue<int>(ids[1], 1234);
+
+    std::cout << "Liberando uno de cada dos bloques...\n";
+    for (size_t i = 0; i < ids.size(); i += 2) {
+        tlsfManager.decreaseRefCount(ids[i]);
+    }
+    double fragmented = tlsfManager.getAllocator().fragmentation();
+    std::cout << "Fragmentación: " << fragmented * 100.0 << "%\n";
+    ASSERT_GT(fragmented, 0.0);
+    ASSERT_EQ(tlsfManager.getValue<int>(ids[1]), 1234);
+
+    std::cout << "Liberando el resto...\n";
+    for (size_t i = 1; i < ids.size(); i += 2) {
+        tlsfManager.decreaseRefCount(ids[i]);
+    }
+    ASSERT_DOUBLE_EQ(tlsfManager.getAllocator().fragmentation(), 0.0);
+    ASSERT_EQ(tlsfManager.getAllocator().largestFreeBlock(), 1'000'000u) << "Los vecinos libres deberían fusionarse";
+
+    int bigId = tlsfManager.allocate(900'000, "string");
+    ASSERT_NE(bigId, -1) << "Debería caber un bloque grande tras fusionar todo";
+
+    std::cout << "[PASS] Prueba TLSF completada con éxito\n";
+}
+
+// Prueba de la política buddy
+TEST(MemoryManagerPolicyTest, BuddyPolicyTest) {
+    std::cout << "\n[TEST] Probando política buddy\n";
+
+    MemoryManagerProgram buddyManager(1, AllocatorPolicy::BUDDY);
+    const FreeSpaceAllocator& allocator = buddyManager.getAllocator();
+    size_t initialLargest = allocator.largestFreeBlock();
+    ASSERT_EQ(initialLargest, 524'288u) << "1 MB debería empezar con un bloque de 512 KB";
+
+    std::vector<int> ids;
+    for (int i = 0; i < 500; ++i) {
+        int id = buddyManager.allocate(64, "string");
+        ASSERT_NE(id, -1);
+        char* address = static_cast<char*>(buddyManager.getBlockAddress(id));
+        char* first = static_cast<char*>(buddyManager.getBlockAddress(ids.empty() ? id : ids[0]));
+        ASSERT_EQ((address - first) % 64, 0) << "Los bloques de 64 bytes deberían quedar alineados entre sí";
+        buddyManager.setValue<std::string>(id, "buddy " + std::to_string(i));
+        ids.push_back(id);
+    }
+    ASSERT_EQ(allocator.blockSpan(40), 64u);
+    ASSERT_EQ(allocator.blockSpan(1), 8u);
+
+    std::cout << "Un bloque chico con alineación mayor que su tamaño...\n";
+    int aligned = buddyManager.allocate(16, BlockType::STRING, 256);
+    ASSERT_NE(aligned, -1);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(buddyManager.getBlockAddress(aligned)) % 256, 0u);
+    buddyManager.setValue<std::string>(aligned, "alineado");
+    ASSERT_EQ(buddyManager.getValue<std::string>(aligned), "alineado");
+    buddyManager.decreaseRefCount(aligned);
+
+    std::cout << "Liberando en orden intercalado...\n";
+    for (size_t i = 1; i < ids.size(); i += 2) buddyManager.decreaseRefCount(ids[i]);
+    ASSERT_EQ(buddyManager.getValue<std::string>(ids[10]), "buddy 10");
+    for (size_t i = 0; i < ids.size(); i += 2) buddyManager.decreaseRefCount(ids[i]);
+
+    ASSERT_EQ(allocator.largestFreeBlock(), initialLargest) << "Los buddies deberían fusionarse por completo";
+    ASSERT_EQ(allocator.totalFreeBytes(), 1'000'000u - 1'000'000u % 8);
+
+    std::cout << "[PASS] Prueba buddy completada con éxito\n";
+}
+
+// Prueba de slabs para bloques escalares
+TEST(MemoryManagerPolicyTest, ScalarSlabTest) {
+    std::cout << "\n[TEST] Probando slabs escalares\n";
+
+    MemoryManagerOptions options;
+    options.scalarSlabs = true;
+    MemoryManagerProgram slabManager(1, options);
+
+    std::vector<int> intIds;
+    std::vector<int> stringIds;
+    for (int i = 0; i < 3000; ++i) {
+        int id = slabManager.allocate(sizeof(int), "int");
+        ASSERT_NE(id, -1);
+        slabManager.setValue<int>(id, i);
+        intIds.push_back(id);
+        if (i % 100 == 0) {
+            int strId = slabManager.allocate(32, "string");
+            slabManager.setValue<std::string>(strId, "s" + std::to_string(i));
+            stringIds.push_back(strId);
+        }
+    }
+
+    const SlabAllocator* intSlab = slabManager.getSlab("int");
+    ASSERT_NE(intSlab, nullptr);
+    ASSERT_EQ(intSlab->getUsedSlots(), 3000u);
+    ASSERT_EQ(intSlab->getPages().size(), 3u) << "3000 ints deberían caber en 3 páginas de 1024";
+    char* first = static_cast<char*>(slabManager.getBlockAddress(intIds[0]));
+    ASSERT_EQ(static_cast<char*>(slabManager.getBlockAddress(intIds[1])), first + sizeof(int))
+        << "Los ints deberían quedar contiguos en su página";
+
+    std::cout << "Liberando los primeros 2048 ints...\n";
+    for (int i = 0; i < 2048; ++i) slabManager.decreaseRefCount(intIds[i]);
+    ASSERT_EQ(intSlab->getPages().size(), 2u) << "Una página vacía debería volver al asignador general";
+
+    std::cout << "Liberando strings y compactando...\n";
+    for (size_t i = 0; i < stringIds.size(); i += 2) slabManager.decreaseRefCount(stringIds[i]);
+    slabManager.compactMemory();
+    ASSERT_EQ(intSlab->getPages().size(), 1u);
+    for (int i = 2048; i < 3000; ++i) {
+        ASSERT_EQ(slabManager.getValue<int>(intIds[i]), i);
+    }
+    for (size_t i = 1; i < stringIds.size(); i += 2) {
+        ASSERT_EQ(slabManager.getValue<std::string>(stringIds[i]), "s" + std::to_string(i * 100));
+    }
+
+    int charId = slabManager.allocate(sizeof(char), "char");
+    slabManager.setValue<char>(charId, 'q');
+    slabManager.decreaseRefCount(intIds[2048]);
+    ASSERT_EQ(slabManager.getValue<char>(charId), 'q');
+
+    std::cout << "[PASS] Prueba de slabs completada con éxito\n";
+}
+
+// Prueba de compactación incremental
+TEST(MemoryManagerPolicyTest, IncrementalCompactionTest) {
+    std::cout << "\n[TEST] Probando compactación incremental\n";
+
+    MemoryManagerOptions options;
+    options.compactionStepBytes = 4096;
+    MemoryManagerProgram incrementalManager(1, options);
+
+    std::vector<int> ids;
+    while (true) {
+        int id = incrementalManager.allocate(1000, "string");
+        if (id == -1) break;
+        incrementalManager.setValue<std::string>(id, "bloque " + std::to_string(id));
+        ids.push_back(id);
+    }
+    ASSERT_EQ(ids.size(), 1000u);
+
+    std::cout << "Liberando la mitad de los bloques...\n";
+    for (size_t i = 0; i < ids.size(); i += 2) incrementalManager.decreaseRefCount(ids[i]);
+
+    std::cout << "Pidiendo un bloque grande con pasos acotados...\n";
+    int bigId = -1;
+    size_t attempts = 0;
+    size_t previousMoved = incrementalManager.getCompactionBytesMoved();
+    while (bigId == -1 && attempts < 1000) {
+        bigId = incrementalManager.allocate(100'000, "string");
+        size_t moved = incrementalManager.getCompactionBytesMoved();
+        ASSERT_LE(moved - previousMoved, 4096u + 1000u) << "Un paso no debería mover más que su presupuesto";
+        previousMoved = moved;
+        attempts++;
+    }
+    std::cout << "Asignado tras " << attempts << " intentos\n";
+    ASSERT_NE(bigId, -1) << "La compactación incremental debería liberar un hueco grande";
+    ASSERT_GT(attempts, 1u) << "No debería compactarse todo en una sola llamada";
+
+    for (size_t i = 1; i < ids.size(); i += 2) {
+        ASSERT_EQ(incrementalManager.getValue<std::string>(ids[i]), "bloque " + std::to_string(ids[i]));
+    }
+
+    std::cout << "[PASS] Prueba de compactación incremental completada con éxito\n";
+}
+
+// Prueba del planificador de compactación en segundo plano
+TEST(MemoryManagerPolicyTest, CompactionSchedulerTest) {
+    std::cout << "\n[TEST] Probando planificador de compactación\n";
+
+    MemoryManagerOptions options;
+    options.compactOnAllocate = false;
+    MemoryManagerProgram backgroundManager(1, options);
+
+    std::vector<int> ids;
+    for (int i = 0; i < 1000; ++i) {
+        int id = backgroundManager.allocate(1000, "string");
+        ASSERT_NE(id, -1);
+        backgroundManager.setValue<std::string>(id, "valor " + std::to_string(i));
+        ids.push_back(id);
+    }
+    for (size_t i = 0; i < ids.size(); i += 2) backgroundManager.decreaseRefCount(ids[i]);
+
+    std::cout << "Asignación grande sin compactar en el camino de la petición...\n";
+    ASSERT_EQ(backgroundManager.allocate(100'000, "string"), -1);
+    ASSERT_EQ(backgroundManager.getCompactionBytesMoved(), 0u) << "allocate() no debería compactar";
+    ASSERT_EQ(backgroundManager.getAllocationCounters().failures, 1u);
+
+    std::vector<CompactionReport> reports;
+    CompactionSchedulerOptions schedulerOptions;
+    CompactionScheduler scheduler(backgroundManager, schedulerOptions,
+        [&reports](const CompactionReport& report) { reports.push_back(report); });
+
+    std::cout << "Ejecutando una evaluación del planificador...\n";
+    ASSERT_TRUE(scheduler.tick());
+    ASSERT_EQ(reports.size(), 1u);
+    std::cout << "Razón: " << reports[0].reason
+              << " | Duración: " << reports[0].duration.count() << " us"
+              << " | Bytes movidos: " << reports[0].bytesMoved << "\n";
+    ASSERT_STREQ(reports[0].reason, "idle");
+    ASSERT_GT(reports[0].bytesMoved, 0u);
+    ASSERT_LT(reports[0].fragmentationAfter, reports[0].fragmentationBefore);
+
+    ASSERT_FALSE(scheduler.tick()) << "Sin cambios nuevos no debería volver a compactar";
+    scheduler.start();
+    scheduler.stop();
+    ASSERT_NE(backgroundManager.allocate(100'000, "string"), -1);
+    for (size_t i = 1; i < ids.size(); i += 2) {
+        ASSERT_EQ(backgroundManager.getValue<std::string>(ids[i]), "valor " + std::to_string(i));
+    }
+
+    std::cout << "[PASS] Prueba del planificador completada con éxito\n";
+}
+
+// Prueba de compactación paralela por regiones
+TEST(MemoryManagerPolicyTest, ParallelCompactionTest) {
+    std::cout << "\n[TEST] Probando compactación paralela\n";
+
+    MemoryManagerOptions options;
+    options.compactionThreads = 4;
+    options.scalarSlabs = true;
+    MemoryManagerProgram parallelManager(20, options);
+
+    std::vector<int> ids;
+    std::vector<std::string> values;
+    for (int i = 0; i < 20000; ++i) {
+        int id;
+        std::string value;
+        if (i % 3 == 0) {
+            id = parallelManager.allocate(sizeof(int), "int");
+            parallelManager.setValue<int>(id, i);
+        } else {
+            size_t size = 100 + (i * 37) % 1500;
+            id = parallelManager.allocate(size, "string");
+            value = "bloque " + std::to_string(i);
+            parallelManager.setValue<std::string>(id, value);
+        }
+        ASSERT_NE(id, -1);
+        ids.push_back(id);
+        values.push_back(value);
+    }
+
+    std::cout << "Liberando dos de cada tres bloques...\n";
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (i % 3 != 1) parallelManager.decreaseRefCount(ids[i]);
+    }
+    size_t freeBefore = parallelManager.getAllocator().totalFreeBytes();
+
+    std::cout << "Compactando con 4 hilos...\n";
+    parallelManager.compactMemory();
+
+    auto freeBlocks = parallelManager.getAllocator().freeBlocks();
+    std::cout << "Huecos libres tras compactar: " << freeBlocks.size() << "\n";
+    ASSERT_LE(freeBlocks.size(), 4u) << "Debería quedar a lo sumo un hueco por región";
+    ASSERT_GE(parallelManager.getAllocator().totalFreeBytes(), freeBefore);
+
+    for (size_t i = 1; i < ids.size(); i += 3) {
+        ASSERT_EQ(parallelManager.getValue<std::string>(ids[i]), values[i]);
+    }
+
+    std::cout << "[PASS] Prueba de compactación paralela completada con éxito\n";
+}
+
+// Prueba de acceso concurrente desde varios hilos
+TEST(MemoryManagerPolicyTest, ConcurrentAccessTest) {
+    std::cout << "\n[TEST] Probando acceso concurrente\n";
+
+    MemoryManagerProgram concurrentManager(4);
+    constexpr int kThreads = 8;
+    constexpr int kBlocksPerThread = 500;
+    std::atomic<bool> done{false};
+    std::atomic<int> errors{0};
+
+    // Un hilo compacta mientras los demás leen y escriben
+    std::thread compactor([&] {
+        while (!done) {
+            concurrentManager.compactMemory();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    std::vector<std::vector<int>> kept(kThreads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreads; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < kBlocksPerThread; ++i) {
+                int id = concurrentManager.allocate(sizeof(int) * 4, "string");
+                std::string value = std::to_string(t * kBlocksPerThread + i);
+                concurrentManager.setValue<std::string>(id, value);
+                concurrentManager.increaseRefCount(id);
+                if (concurrentManager.getValue<std::string>(id) != value) errors++;
+                concurrentManager.decreaseRefCount(id);
+                if (i % 2 == 0) concurrentManager.decreaseRefCount(id);
+                else kept[t].push_back(id);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    done = true;
+    compactor.join();
+
+    std::cout << "Verificando bloques conservados...\n";
+    ASSERT_EQ(errors.load(), 0);
+    for (int t = 0; t < kThreads; ++t) {
+        for (size_t k = 0; k < kept[t].size(); ++k) {
+            int i = static_cast<int>(k) * 2 + 1;
+            ASSERT_EQ(concurrentManager.getValue<std::string>(kept[t][k]), std::to_string(t * kBlocksPerThread + i));
+        }
+    }
+    AllocationCounters counters = concurrentManager.getAllocationCounters();
+    ASSERT_EQ(counters.allocations, static_cast<size_t>(kThreads * kBlocksPerThread));
+    ASSERT_EQ(counters.frees, static_cast<size_t>(kThreads * kBlocksPerThread / 2));
+
+    std::cout << "[PASS] Prueba de acceso concurrente completada con éxito\n";
+}
+
+// Prueba de contadores de referencias concurrentes
+TEST(MemoryManagerPolicyTest, AtomicRefCountTest) {
+    std::cout << "\n[TEST] Probando contadores de referencias atómicos\n";
+
+    MemoryManagerProgram refManager(1);
+    int id = refManager.allocate(sizeof(int), "int");
+    refManager.setValue<int>(id, 7);
+
+    constexpr int kThreads = 8;
+    constexpr int kIterations = 10000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreads; ++t) {
+        workers.emplace_back([&] {
+            for (int i = 0; i < kIterations; ++i) {
+                refManager.increaseRefCount(id);
+                refManager.decreaseRefCount(id);
+            }
+            refManager.increaseRefCount(id);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    std::cout << "Verificando el contador final...\n";
+    ASSERT_EQ(refManager.increaseRefCount(id), kThreads + 2);
+    for (int i = 0; i < kThreads + 1; ++i) refManager.decreaseRefCount(id);
+    ASSERT_EQ(refManager.getValue<int>(id), 7);
+
+    std::cout << "Liberando el bloque al llegar a cero...\n";
+    ASSERT_EQ(refManager.decreaseRefCount(id), 0);
+    ASSERT_THROW(refManager.increaseRefCount(id), std::runtime_error);
+    ASSERT_THROW(refManager.decreaseRefCount(id), std::runtime_error);
+    ASSERT_EQ(refManager.getAllocationCounters().frees, 1u);
+
+    std::cout << "[PASS] Prueba de contadores de referencias completada con éxito\n";
+}
+
+// Prueba de cachés de asignación por hilo
+TEST(MemoryManagerPolicyTest, ThreadCacheTest) {
+    std::cout << "\n[TEST] Probando cachés de asignación por hilo\n";
+
+    MemoryManagerOptions options;
+    options.threadCacheBlocks = 32;
+    MemoryManagerProgram cacheManager(1, options);
+
+    std::cout << "El primer Create precorta un lote completo...\n";
+    size_t freeBefore = cacheManager.getAllocator().totalFreeBytes();
+    int first = cacheManager.allocate(16, "string");
+    ASSERT_EQ(cacheManager.getAllocator().totalFreeBytes(), freeBefore - 32 * 16);
+
+    std::cout << "Un bloque liberado se reutiliza desde la caché...\n";
+    void* firstAddr = cacheManager.getBlockAddress(first);
+    cacheManager.decreaseRefCount(first);
+    int reused = cacheManager.allocate(16, "string");
+    ASSERT_EQ(cacheManager.getBlockAddress(reused), firstAddr);
+
+    std::cout << "Varios hilos asignando y liberando en paralelo...\n";
+    constexpr int kThreads = 4;
+    std::vector<std::vector<int>> kept(kThreads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreads; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < 1000; ++i) {
+                int id = cacheManager.allocate(16, "string");
+                cacheManager.setValue<std::string>(id, std::to_string(t * 1000 + i));
+                if (i % 4 == 0) kept[t].push_back(id);
+                else cacheManager.decreaseRefCount(id);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    std::cout << "Los hilos que terminan devuelven sus cachés...\n";
+    ASSERT_EQ(cacheManager.getThreadCacheCount(), 1u);
+    ASSERT_EQ(cacheManager.getAllocator().totalFreeBytes(), freeBefore - 32 * 16 - kThreads * 250 * 16);
+
+    std::cout << "Compactar vacía las cachés sin perder bloques vivos...\n";
+    cacheManager.compactMemory();
+    for (int t = 0; t < kThreads; ++t) {
+        for (size_t k = 0; k < kept[t].size(); ++k) {
+            ASSERT_EQ(cacheManager.getValue<std::string>(kept[t][k]), std::to_string(t * 1000 + static_cast<int>(k) * 4));
+        }
+    }
+    size_t liveBytes = (kThreads * 250 + 1) * 16;
+    ASSERT_EQ(cacheManager.getAllocator().totalFreeBytes(), freeBefore - liveBytes);
+
+    std::cout << "[PASS] Prueba de cachés por hilo completada con éxito\n";
+}
+
+// Prueba de arena respaldado por mmap
+TEST(MemoryManagerPolicyTest, MmapArenaTest) {
+    std::cout << "\n[TEST] Probando arena con mmap\n";
+
+    for (HugePages hugePages : {HugePages::NONE, HugePages::TRANSPARENT, HugePages::EXPLICIT}) {
+        MemoryManagerOptions options;
+        options.arena.backing = ArenaBacking::MMAP;
+        options.arena.hugePages = hugePages;
+        options.arena.prefault = true;
+        MemoryManagerProgram mmapManager(4, options);
+
+        std::cout << "Arena: " << mmapManager.getArena().describe() << "\n";
+        ASSERT_GE(mmapManager.getArena().pageSize(), Arena::systemPageSize());
+        ASSERT_EQ(mmapManager.getArena().size(), 4'000'000u);
+
+        int id = mmapManager.allocate(sizeof(double), "double");
+        mmapManager.setValue<double>(id, 2.5);
+        ASSERT_EQ(mmapManager.getValue<double>(id), 2.5);
+    }
+
+    ASSERT_THROW(parseHugePages("gigante"), std::runtime_error);
+    ASSERT_THROW(parseArenaBacking("sbrk"), std::runtime_error);
+
+    std::cout << "[PASS] Prueba de arena con mmap completada con éxito\n";
+}
+
+// Prueba de arena que crece y se achica por chunks
+TEST(MemoryManagerPolicyTest, GrowableArenaTest) {
+    std::cout << "\n[TEST] Probando arena con chunks\n";
+
+    MemoryManagerOptions options;
+    options.maxSizeMB = 3;
+    options.chunkSizeMB = 1;
+    MemoryManagerProgram growManager(1, options);
+
+    std::cout << "Asignando más de lo que entra en el arena inicial...\n";
+    std::vector<int> ids;
+    for (int i = 0; i < 25; ++i) {
+        int id = growManager.allocate(100'000, "string");
+        ASSERT_NE(id, -1) << "El arena debería crecer hasta 3 MB";
+        growManager.setValue<std::string>(id, "chunk " + std::to_string(i));
+        ids.push_back(id);
+    }
+    ASSERT_EQ(growManager.getChunkCount(), 3u);
+    ASSERT_EQ(growManager.getTotalMemory(), 3'000'000u);
+    ASSERT_EQ(growManager.allocate(900'000, "string"), -1) << "No debería pasar del límite";
+
+    std::cout << "Verificando valores en todos los chunks...\n";
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ASSERT_EQ(growManager.getValue<std::string>(ids[i]), "chunk " + std::to_string(i));
+    }
+
+    std::cout << "Liberando y compactando devuelve los chunks vacíos...\n";
+    for (size_t i = 5; i < ids.size(); ++i) growManager.decreaseRefCount(ids[i]);
+    growManager.compactMemory();
+    ASSERT_EQ(growManager.getChunkCount(), 1u);
+    ASSERT_EQ(growManager.getTotalMemory(), 1'000'000u);
+    ASSERT_EQ(growManager.getAllocator().totalFreeBytes(), 500'000u);
+    for (size_t i = 0; i < 5; ++i) {
+        ASSERT_EQ(growManager.getValue<std::string>(ids[i]), "chunk " + std::to_string(i));
+    }
+
+    std::cout << "La política buddy no puede crecer...\n";
+    options.policy = AllocatorPolicy::BUDDY;
+    MemoryManagerProgram buddyManager(1, options);
+    ASSERT_EQ(buddyManager.allocate(900'000, "string"), -1);
+    ASSERT_EQ(buddyManager.getChunkCount(), 1u);
+
+    std::cout << "[PASS] Prueba de arena con chunks completada con éxito\n";
+}
+
+// Prueba de devolución de páginas libres al sistema
+TEST(MemoryManagerPolicyTest, ScavengeTest) {
+    std::cout << "\n[TEST] Probando devolución de páginas al sistema\n";
+
+    MemoryManagerOptions options;
+    options.arena.backing = ArenaBacking::MMAP;
+    MemoryManagerProgram scavengeManager(8, options);
+
+    std::cout << "Ráfaga de strings grandes...\n";
+    std::vector<int> ids;
+    for (int i = 0; i < 6; ++i) {
+        int id = scavengeManager.allocate(1'000'000, "string");
+        scavengeManager.setValue<std::string>(id, std::string(999'999, 'x'));
+        ids.push_back(id);
+    }
+    size_t residentBefore = scavengeManager.getResidentBytes();
+    std::cout << "Residente tras la ráfaga: " << residentBefore << " bytes\n";
+    ASSERT_GE(residentBefore, 6'000'000u);
+
+    std::cout << "Liberando y devolviendo páginas...\n";
+    for (size_t i = 1; i < ids.size(); ++i) scavengeManager.decreaseRefCount(ids[i]);
+    size_t released = scavengeManager.scavenge(64 * 1024);
+    size_t residentAfter = scavengeManager.getResidentBytes();
+    std::cout << "Liberados: " << released << " bytes | Residente: " << residentAfter << " bytes\n";
+    ASSERT_GE(released, 5'000'000u);
+    ASSERT_LT(residentAfter, 2'000'000u) << "Sólo debería quedar residente el bloque vivo";
+    ASSERT_EQ(scavengeManager.getValue<std::string>(ids[0]), std::string(999'999, 'x'));
+
+    std::cout << "Una segunda pasada sin cambios no repite madvise...\n";
+    ASSERT_EQ(scavengeManager.scavenge(64 * 1024), 0u);
+
+    std::cout << "El espacio devuelto se puede volver a usar...\n";
+    int reused = scavengeManager.allocate(2'000'000, "string");
+    scavengeManager.setValue<std::string>(reused, "de vuelta");
+    ASSERT_EQ(scavengeManager.getValue<std::string>(reused), "de vuelta");
+
+    std::cout << "[PASS] Prueba de devolución de páginas completada con éxito\n";
+}
+
+// Prueba de metadatos compactos con tipo enumerado
+TEST(MemoryManagerPolicyTest, BlockTypeMetadataTest) {
+    std::cout << "\n[TEST] Probando metadatos con tipo enumerado\n";
+
+    std::cout << "Metadatos por bloque: " << BlockTable::bytesPerBlock() << " bytes\n";
+    ASSERT_LE(BlockTable::bytesPerBlock(), 24u);
+
+    MemoryManagerProgram typeManager(1);
+    int doubleId = typeManager.allocate(sizeof(double), BlockType::DOUBLE);
+    int longId = typeManager.allocate(sizeof(long long), "long long");
+    ASSERT_EQ(typeManager.getBlockType(doubleId), BlockType::DOUBLE);
+    ASSERT_EQ(typeManager.getBlockType(longId), BlockType::LONG_LONG);
+
+    typeManager.setValue<long long>(longId, 1LL << 40);
+    ASSERT_EQ(typeManager.getValue<long long>(longId), 1LL << 40);
+    ASSERT_THROW(typeManager.setValue<int>(longId, 1), std::runtime_error);
+
+    std::cout << "Tipos desconocidos se rechazan al asignar...\n";
+    ASSERT_THROW(typeManager.allocate(8, "struct"), std::runtime_error);
+    ASSERT_THROW(typeManager.allocate(1, BlockType::INT), std::runtime_error);
+
+    std::cout << "[PASS] Prueba de metadatos con tipo enumerado completada con éxito\n";
+}
+
+// Prueba de la tabla de metadatos en arreglos paralelos
+TEST(MemoryManagerPolicyTest, BlockTableTest) {
+    std::cout << "\n[TEST] Probando tabla de metadatos structure of arrays\n";
+
+    BlockTable table;
+    char arena[64];
+    for (int id = 1; id <= 4; ++id) {
+        table.insert(id, arena + id * 8, id * 2, id == 4 ? BlockType::STRING : BlockType::INT, id == 2);
+    }
+    ASSERT_EQ(table.size(), 4u);
+    ASSERT_TRUE(table.inSlab(table.find(2)));
+    ASSERT_TRUE(table.initialized(table.find(3)));
+
+    std::cout << "Borrar mueve el último bloque al hueco...\n";
+    table.refcounts[table.find(4)].value = 7;
+    table.erase(table.find(1));
+    ASSERT_EQ(table.size(), 3u);
+    ASSERT_FALSE(table.contains(1));
+    size_t pos = table.find(4);
+    ASSERT_EQ(pos, 0u);
+    ASSERT_EQ(table.addresses[pos], arena + 32);
+    ASSERT_EQ(table.sizes[pos], 8u);
+    ASSERT_EQ(table.types[pos], BlockType::STRING);
+    ASSERT_EQ(table.refcounts[pos].value.load(), 7);
+    ASSERT_THROW(table.find(1), std::runtime_error);
+
+    std::cout << "[PASS] Prueba de tabla de metadatos completada con éxito\n";
+}
+
+// Prueba de escalares guardados en los metadatos, sin tocar el arena
+TEST(MemoryManagerPolicyTest, InlineScalarTest) {
+    std::cout << "\n[TEST] Probando escalares inline\n";
+
+    MemoryManagerOptions options;
+    options.inlineScalars = true;
+    MemoryManagerProgram inlineManager(1, options);
+    auto freeBytes = [&inlineManager] {
+        size_t total = 0;
+        for (const auto& block : inlineManager.getAllocator().freeBlocks()) total += block.size;
+        return total;
+    };
+    size_t freeBefore = freeBytes();
+
+    int intId = inlineManager.allocate(sizeof(int), BlockType::INT);
+    int doubleId = inlineManager.allocate(sizeof(double), BlockType::DOUBLE);
+    int charId = inlineManager.allocate(sizeof(char), BlockType::CHAR);
+    int stringId = inlineManager.allocate(8, BlockType::STRING);
+    int bigId = inlineManager.allocate(16, BlockType::INT);
+
+    std::cout << "Los escalares no ocupan espacio del asignador...\n";
+    ASSERT_EQ(inlineManager.getBlockAddress(intId), nullptr);
+    ASSERT_EQ(inlineManager.getBlockAddress(doubleId), nullptr);
+    ASSERT_NE(inlineManager.getBlockAddress(stringId), nullptr);
+    ASSERT_NE(inlineManager.getBlockAddress(bigId), nullptr);
+    ASSERT_EQ(freeBytes(), freeBefore - 8 - 16);
+
+    inlineManager.setValue<int>(intId, -42);
+    inlineManager.setValue<double>(doubleId, 2.5);
+    inlineManager.setValue<char>(charId, 'z');
+    ASSERT_EQ(inlineManager.getValue<int>(intId), -42);
+    ASSERT_EQ(inlineManager.getValue<double>(doubleId), 2.5);
+    ASSERT_EQ(inlineManager.getValue<char>(charId), 'z');
+
+    std::cout << "Compactar y liberar no afecta a los valores inline...\n";
+    inlineManager.decreaseRefCount(bigId);
+    inlineManager.compactMemory();
+    ASSERT_EQ(inlineManager.getValue<int>(intId), -42);
+    ASSERT_EQ(inlineManager.getValue<double>(doubleId), 2.5);
+
+    inlineManager.decreaseRefCount(intId);
+    ASSERT_THROW(inlineManager.getValue<int>(intId), std::runtime_error);
+    ASSERT_EQ(inlineManager.getValue<char>(charId), 'z');
+    ASSERT_EQ(freeBytes(), freeBefore - 8);
+
+    std::cout << "[PASS] Prueba de escalares inline completada con éxito\n";
+}
+
+// Prueba de IDs con slot y generación
+TEST(MemoryManagerPolicyTest, RecycledIdTest) {
+    std::cout << "\n[TEST] Probando IDs reciclados con generación\n";
+
+    MemoryManagerProgram idManager(1);
+    int first = idManager.allocate(sizeof(int), "int");
+    idManager.setValue<int>(first, 11);
+    idManager.decreaseRefCount(first);
+
+    std::cout << "El slot liberado se reusa con otra generación...\n";
+    int second = idManager.allocate(sizeof(int), "int");
+    ASSERT_EQ(blockSlot(second), blockSlot(first));
+    ASSERT_NE(second, first);
+    ASSERT_EQ(blockGeneration(second), blockGeneration(first) + 1);
+
+    std::cout << "Un ID viejo se rechaza en vez de apuntar al bloque nuevo...\n";
+    idManager.setValue<int>(second, 22);
+    ASSERT_THROW(idManager.getValue<int>(first), std::runtime_error);
+    ASSERT_THROW(idManager.increaseRefCount(first), std::runtime_error);
+    ASSERT_EQ(idManager.getValue<int>(second), 22);
+
+    std::cout << "Hilos concurrentes nunca reciben el mismo ID vivo...\n";
+    BlockIdAllocator blockIds;
+    std::vector<std::vector<int>> perThread(4);
+    std::vector<std::thread> workers;
+    for (auto& owned : perThread) {
+        workers.emplace_back([&blockIds, &owned] {
+            for (int round = 0; round < 1000; ++round) {
+                int id = blockIds.acquire();
+                if (round % 2 == 0) blockIds.release(id);
+                else owned.push_back(id);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    std::set<int> live;
+    for (const auto& owned : perThread) live.insert(owned.begin(), owned.end());
+    ASSERT_EQ(live.size(), 2000u);
+    ASSERT_EQ(blockIds.liveCount(), 2000u);
+    ASSERT_LE(blockIds.slotCount(), 2004u);
+
+    std::cout << "Un slot que agota sus generaciones se retira en vez de repetir IDs...\n";
+    BlockIdAllocator wrapIds;
+    std::set<int> seen;
+    for (uint32_t i = 0; i < 2 * (kBlockGenerationMask + 1); ++i) {
+        int id = wrapIds.acquire();
+        ASSERT_TRUE(seen.insert(id).second) << "El ID " << id << " se repitió";
+        wrapIds.release(id);
+    }
+    ASSERT_EQ(wrapIds.retiredCount(), 2u);
+    ASSERT_EQ(wrapIds.slotCount(), 2u);
+    ASSERT_EQ(wrapIds.liveCount(), 0u);
+
+    std::cout << "Un ID cancelado vuelve sin cambiar de generación...\n";
+    int unused = wrapIds.acquire();
+    wrapIds.cancel(unused);
+    ASSERT_EQ(wrapIds.acquire(), unused);
+
+    std::cout << "[PASS] Prueba de IDs reciclados completada con éxito\n";
+}
+
+// Prueba de Get sin locks sobre escalares mientras otro hilo escribe
+TEST(MemoryManagerPolicyTest, SeqlockGetTest) {
+    std::cout << "\n[TEST] Probando Get con seqlock\n";
+
+    MemoryManagerProgram seqManager(1);
+    int counter = seqManager.allocate(sizeof(long long), "long long");
+    seqManager.setValue<long long>(counter, 0);
+
+    std::cout << "Los lectores ven valores completos y en orden...\n";
+    constexpr long long kWrites = 20000;
+    std::atomic<bool> torn{false};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            long long last = 0;
+            while (last < kWrites) {
+                long long value = seqManager.getValue<long long>(counter);
+                // Cada valor escrito repite el mismo número en las dos mitades
+                long long low = value & 0xffffffff;
+                if ((value >> 32) != low || low < last) torn = true;
+                last = low;
+            }
+        });
+    }
+    for (long long i = 1; i <= kWrites; ++i) {
+        seqManager.setValue<long long>(counter, (i << 32) | i);
+    }
+    for (auto& reader : readers) reader.join();
+    ASSERT_FALSE(torn.load());
+
+    std::cout << "Tipo incorrecto e ID liberado siguen dando error...\n";
+    ASSERT_THROW(seqManager.getValue<int>(counter), std::runtime_error);
+    seqManager.decreaseRefCount(counter);
+    ASSERT_THROW(seqManager.getValue<long long>(counter), std::runtime_error);
+
+    std::cout << "[PASS] Prueba de Get con seqlock completada con éxito\n";
+}
+
+// Prueba de bloques alineados según su tipo
+TEST(MemoryManagerPolicyTest, AlignedAllocationTest) {
+    std::cout << "\n[TEST] Probando asignación alineada\n";
+
+    auto isAligned = [](void* address, size_t alignment) {
+        return reinterpret_cast<uintptr_t>(address) % alignment == 0;
+    };
+
+    for (AllocatorPolicy policy : {AllocatorPolicy::FIRST_FIT, AllocatorPolicy::SIZE_CLASS, AllocatorPolicy::TLSF}) {
+        MemoryManagerProgram alignedManager(1, policy);
+        std::cout << "Política " << alignedManager.getAllocator().name() << "...\n";
+
+        // Un char deja el siguiente hueco desalineado
+        std::vector<int> chars;
+        std::vector<int> doubles;
+        for (int i = 0; i < 20; ++i) {
+            chars.push_back(alignedManager.allocate(sizeof(char), "char"));
+            doubles.push_back(alignedManager.allocate(sizeof(double), "double"));
+            ASSERT_TRUE(isAligned(alignedManager.getBlockAddress(doubles.back()), alignof(double)));
+        }
+        int hot = alignedManager.allocate(sizeof(int), BlockType::INT, 64);
+        ASSERT_TRUE(isAligned(alignedManager.getBlockAddress(hot), 64));
+        ASSERT_THROW(alignedManager.allocate(sizeof(int), BlockType::INT, 48), std::runtime_error);
+
+        std::cout << "La compactación conserva la alineación...\n";
+        for (int i = 0; i < 20; i += 2) alignedManager.decreaseRefCount(chars[i]);
+        alignedManager.setValue<double>(doubles[19], 3.25);
+        alignedManager.compactMemory();
+        for (int id : doubles) {
+            ASSERT_TRUE(isAligned(alignedManager.getBlockAddress(id), alignof(double)));
+        }
+        ASSERT_TRUE(isAligned(alignedManager.getBlockAddress(hot), 64));
+        ASSERT_EQ(alignedManager.getValue<double>(doubles[19]), 3.25);
+        size_t padding = alignedManager.getAllocator().paddingBytes();
+        alignedManager.compactMemory();
+        ASSERT_EQ(alignedManager.getAllocator().paddingBytes(), padding) << "Compactar de nuevo no debería sumar padding";
+    }
+
+    std::cout << "Un hueco de clase que la compactación dejó desalineado no se reutiliza mal...\n";
+    {
+        MemoryManagerProgram classManager(1, AllocatorPolicy::SIZE_CLASS);
+        int first = classManager.allocate(sizeof(char), "char");
+        int odd = classManager.allocate(3, "string");
+        classManager.compactMemory();
+        classManager.decreaseRefCount(odd);
+        int reused = classManager.allocate(sizeof(int), "int");
+        ASSERT_TRUE(isAligned(classManager.getBlockAddress(reused), alignof(int)));
+        int wide = classManager.allocate(16, BlockType::STRING, 16);
+        ASSERT_TRUE(isAligned(classManager.getBlockAddress(wide), 16));
+        int tail = classManager.allocate(16, "string");
+        classManager.setValue<int>(reused, 7);
+        classManager.setValue<std::string>(wide, "ancho");
+        classManager.setValue<std::string>(tail, "tail-data");
+        classManager.decreaseRefCount(first);
+        classManager.compactMemory();
+        ASSERT_TRUE(isAligned(classManager.getBlockAddress(reused), alignof(int)));
+        ASSERT_TRUE(isAligned(classManager.getBlockAddress(wide), 16));
+        ASSERT_EQ(classManager.getValue<int>(reused), 7);
+        ASSERT_EQ(classManager.getValue<std::string>(wide), "ancho");
+        ASSERT_EQ(classManager.getValue<std::string>(tail), "tail-data");
+    }
+
+    std::cout << "La caché del hilo sólo reutiliza huecos que cumplen la alineación del bin...\n";
+    {
+        MemoryManagerOptions cacheOptions;
+        cacheOptions.threadCacheBlocks = 4;
+        MemoryManagerProgram cacheManager(1, cacheOptions);
+        auto created = cacheManager.allocateBatch({{sizeof(char), BlockType::CHAR}, {64, BlockType::STRING}, {64, BlockType::STRING}});
+        int neighbour = created[2].value;
+        cacheManager.decreaseRefCount(created[1].value);
+        int reused = cacheManager.allocate(64, "string");
+        ASSERT_TRUE(isAligned(cacheManager.getBlockAddress(reused), 16));
+        cacheManager.setValue<std::string>(reused, "reutilizado");
+        cacheManager.setValue<std::string>(neighbour, "vecino");
+        cacheManager.compactMemory();
+        ASSERT_TRUE(isAligned(cacheManager.getBlockAddress(reused), 16));
+        ASSERT_EQ(cacheManager.getValue<std::string>(reused), "reutilizado");
+        ASSERT_EQ(cacheManager.getValue<std::string>(neighbour), "vecino");
+    }
+
+    std::cout << "Reutilizar y compactar conserva alineación y valores en todos los caminos...\n";
+    for (AllocatorPolicy policy : {AllocatorPolicy::FIRST_FIT, AllocatorPolicy::SIZE_CLASS, AllocatorPolicy::TLSF}) {
+        for (size_t cacheBlocks : {size_t(0), size_t(4)}) {
+            MemoryManagerOptions reuseOptions;
+            reuseOptions.policy = policy;
+            reuseOptions.threadCacheBlocks = cacheBlocks;
+            MemoryManagerProgram reuseManager(1, reuseOptions);
+            std::map<int, std::pair<size_t, std::string>> strings; // ID -> alineación, valor
+            std::map<int, double> doubles;
+
+            auto check = [&] {
+                for (const auto& [id, expected] : strings) {
+                    ASSERT_TRUE(isAligned(reuseManager.getBlockAddress(id), expected.first));
+                    ASSERT_EQ(reuseManager.getValue<std::string>(id), expected.second);
+                }
+                for (const auto& [id, value] : doubles) {
+                    ASSERT_TRUE(isAligned(reuseManager.getBlockAddress(id), alignof(double)));
+                    ASSERT_EQ(reuseManager.getValue<double>(id), value);
+                }
+            };
+            auto fill = [&](int round) {
+                // Lote: un char desalinea lo que sigue si nadie lo corrige
+                auto batch = reuseManager.allocateBatch({{sizeof(char), BlockType::CHAR}, {3, BlockType::STRING},
+                                                         {64, BlockType::STRING}, {sizeof(double), BlockType::DOUBLE}});
+                for (const auto& created : batch) ASSERT_TRUE(created.ok());
+                strings[batch[1].value] = {1, std::string(1, static_cast<char>('a' + round))};
+                strings[batch[2].value] = {1, "lote " + std::to_string(round)};
+                doubles[batch[3].value] = round + 0.5;
+                int wide = reuseManager.allocate(16, BlockType::STRING, 16);
+                int line = reuseManager.allocate(24, BlockType::STRING, 64);
+                strings[wide] = {16, "ancho " + std::to_string(round)};
+                strings[line] = {64, "linea " + std::to_string(round)};
+                int single = reuseManager.allocate(sizeof(double), "double");
+                doubles[single] = round * 2.0;
+            };
+
+            for (int round = 0; round < 6; ++round) fill(round);
+            for (const auto& [id, expected] : strings) reuseManager.setValue<std::string>(id, expected.second);
+            for (const auto& [id, value] : doubles) reuseManager.setValue<double>(id, value);
+            check();
+
+            for (int pass = 0; pass < 2; ++pass) {
+                // Liberar uno de cada dos y volver a pedir: los huecos se reutilizan
+                bool drop = false;
+                for (auto it = strings.begin(); it != strings.end(); drop = !drop) {
+                    if (drop) {
+                        reuseManager.decreaseRefCount(it->first);
+                        it = strings.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                for (int round = 0; round < 3; ++round) fill(10 * (pass + 1) + round);
+                for (const auto& [id, expected] : strings) reuseManager.setValue<std::string>(id, expected.second);
+                for (const auto& [id, value] : doubles) reuseManager.setValue<double>(id, value);
+                check();
+                reuseManager.compactMemory();
+                check();
+            }
+        }
+    }
+
+    std::cout << "Con cacheLineAlignment cada bloque empieza en una línea...\n";
+    MemoryManagerOptions options;
+    options.cacheLineAlignment = true;
+    MemoryManagerProgram lineManager(1, options);
+    int text = lineManager.allocate(3, "string");
+    int line = lineManager.allocate(sizeof(int), "int");
+    ASSERT_TRUE(isAligned(lineManager.getBlockAddress(line), 64));
+    ASSERT_GT(lineManager.getAllocator().paddingBytes(), 0u);
+    lineManager.decreaseRefCount(text);
+    lineManager.decreaseRefCount(line);
+    ASSERT_EQ(lineManager.getAllocator().paddingBytes(), 0u) << "El padding de bloques liberados no debería seguir contando";
+
+    std::cout << "[PASS] Prueba de asignación alineada completada con éxito\n";
+}
+
+// Prueba de operaciones por lotes
+TEST(MemoryManagerPolicyTest, BatchOperationsTest) {
+    std::cout << "\n[TEST] Probando operaciones por lotes\n";
+
+    MemoryManagerProgram batchManager(1);
+    auto created = batchManager.allocateBatch({
+        {sizeof(int), BlockType::INT}, {16, BlockType::STRING}, {1, BlockType::INT}, {sizeof(char), BlockType::CHAR}});
+    ASSERT_EQ(created.size(), 4u);
+    ASSERT_TRUE(created[0].ok());
+    ASSERT_TRUE(created[1].ok());
+    ASSERT_FALSE(created[2].ok()); // Muy chico para un int
+    ASSERT_EQ(created[2].value, -1);
+    ASSERT_TRUE(created[3].ok());
+    ASSERT_EQ(batchManager.getAllocationCounters().allocations, 4u);
+    int intId = created[0].value;
+    int stringId = created[1].value;
+    int charId = created[3].value;
+
+    std::cout << "Escritura y lectura en lote...\n";
+    int32_t number = 42;
+    auto written = batchManager.setValues({
+        {intId, BlockType::INT, std::string(reinterpret_cast<const char*>(&number), sizeof(number))},
+        {stringId, BlockType::STRING, "hola"},
+        {charId, BlockType::INT, std::string(sizeof(int32_t), '\0')}});
+    ASSERT_TRUE(written[0].ok());
+    ASSERT_EQ(written[0].value, sizeof(int32_t));
+    ASSERT_TRUE(written[1].ok());
+    ASSERT_FALSE(written[2].ok()); // Tipo equivocado
+    ASSERT_EQ(batchManager.getValue<int>(intId), 42);
+
+    auto values = batchManager.getValues({stringId, intId, 12345});
+    ASSERT_TRUE(values[0].ok());
+    ASSERT_EQ(values[0].value.type, BlockType::STRING);
+    ASSERT_EQ(values[0].value.bytes, "hola");
+    ASSERT_TRUE(values[1].ok());
+    int32_t read;
+    std::memcpy(&read, values[1].value.bytes.data(), sizeof(read));
+    ASSERT_EQ(read, 42);
+    ASSERT_FALSE(values[2].ok());
+
+    std::cout << "Contadores en lote; los que llegan a 0 se liberan...\n";
+    auto counts = batchManager.applyRefDeltas({{intId, 2}, {stringId, -1}, {charId, -2}, {intId, -3}});
+    ASSERT_EQ(counts[0].value, 3);
+    ASSERT_EQ(counts[1].value, 0);
+    ASSERT_FALSE(counts[2].ok()); // Quedaría negativo
+    ASSERT_EQ(counts[3].value, 0);
+    ASSERT_THROW(batchManager.getBlockType(stringId), std::runtime_error);
+    ASSERT_THROW(batchManager.getBlockType(intId), std::runtime_error);
+    ASSERT_EQ(batchManager.getBlockType(charId), BlockType::CHAR);
+    ASSERT_EQ(batchManager.getAllocationCounters().frees, 2u);
+
+    std::cout << "Un delta que desbordaría el contador se rechaza...\n";
+    auto overflow = batchManager.applyRefDeltas({{charId, INT32_MAX}, {charId, 0}});
+    ASSERT_FALSE(overflow[0].ok());
+    ASSERT_EQ(overflow[1].value, 1);
+
+    std::cout << "Lotes, cachés de hilo y compactación conservan alineación y valores...\n";
+    MemoryManagerOptions cacheOptions;
+    cacheOptions.threadCacheBlocks = 4;
+    MemoryManagerProgram cachedManager(1, cacheOptions);
+    std::vector<BlockSpec> specs;
+    for (int i = 0; i < 16; ++i) {
+        specs.push_back({sizeof(char), BlockType::CHAR});
+        specs.push_back({64, BlockType::STRING});
+        specs.push_back({sizeof(int), BlockType::INT});
+    }
+    auto batch = cachedManager.allocateBatch(specs);
+    std::map<int, std::string> texts;
+    std::map<int, int> numbers;
+    for (size_t i = 1; i < batch.size(); i += 3) {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(cachedManager.getBlockAddress(batch[i].value)) % 16, 0u);
+        texts[batch[i].value] = "lote " + std::to_string(i);
+        numbers[batch[i + 1].value] = static_cast<int>(i);
+    }
+    // Mitad por la caché del hilo, mitad por el camino por lotes
+    for (size_t i = 1; i < batch.size(); i += 12) {
+        cachedManager.decreaseRefCount(batch[i].value);
+        cachedManager.applyRefDeltas({{batch[i + 6].value, -1}});
+        texts.erase(batch[i].value);
+        texts.erase(batch[i + 6].value);
+    }
+    for (int i = 0; i < 8; ++i) {
+        int id = cachedManager.allocate(64, "string");
+        texts[id] = "nuevo " + std::to_string(i);
+    }
+    for (const auto& [id, text] : texts) cachedManager.setValue<std::string>(id, text);
+    for (const auto& [id, number] : numbers) cachedManager.setValue<int>(id, number);
+    for (int round = 0; round < 2; ++round) {
+        cachedManager.compactMemory();
+        for (const auto& [id, text] : texts) {
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(cachedManager.getBlockAddress(id)) % 16, 0u);
+            ASSERT_EQ(cachedManager.getValue<std::string>(id), text);
+        }
+        for (const auto& [id, number] : numbers) ASSERT_EQ(cachedManager.getValue<int>(id), number);
+    }
+
+    std::cout << "[PASS] Prueba de operaciones por lotes completada con éxito\n";
+}
+
 int main(int argc, char** argv) {
     std::cout << "========================================\n";
     std::cout << "INICIANDO PRUEBAS UNITARIAS COMPLETAS\n";